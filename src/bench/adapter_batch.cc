@@ -0,0 +1,59 @@
+// Копирование против переноса и поштучная вставка против пачечной для
+// s21::stack и s21::queue.
+// Запуск: ./bench/adapter_batch [n]
+#include <string>
+#include <vector>
+
+#include "../s21_queue.h"
+#include "../s21_stack.h"
+#include "../s21_vector.h"
+#include "bench.h"
+
+namespace {
+// Строки длиннее буфера SSO, чтобы копия стоила выделения памяти.
+std::vector<std::string> makeStrings(std::size_t n) {
+  std::vector<std::string> strings(n);
+  for (std::size_t i = 0; i < n; ++i)
+    strings[i] = std::string(40, 'a') + std::to_string(i);
+  return strings;
+}
+
+template <typename Adapter>
+void copyVsMove(const char *name, std::size_t n) {
+  std::vector<std::string> source = makeStrings(n);
+  Adapter copied, moved;
+  double copy_ms = bench::measure([&] {
+    for (const auto &item : source) copied.push(item);
+  });
+  double move_ms = bench::measure([&] {
+    for (auto &item : source) moved.push(std::move(item));
+  });
+  std::printf("%-24s copy %8.2f ms   move %8.2f ms\n", name, copy_ms,
+              move_ms);
+}
+
+template <typename Adapter>
+void loopVsRange(const char *name, std::size_t n) {
+  std::vector<int> source(n, 1);
+  Adapter looped, ranged;
+  double loop_ms = bench::measure([&] {
+    for (int item : source) looped.push(item);
+  });
+  double range_ms = bench::measure(
+      [&] { ranged.push_range(source.begin(), source.end()); });
+  bench::keep(looped.size() + ranged.size());
+  std::printf("%-24s loop %8.2f ms  range %8.2f ms\n", name, loop_ms,
+              range_ms);
+}
+}  // namespace
+
+int main(int argc, char **argv) {
+  const std::size_t n = bench::sizeArg(argc, argv, 1000000);
+  std::printf("n = %zu\n", n);
+  copyVsMove<s21::stack<std::string>>("stack<string>", n);
+  copyVsMove<s21::queue<std::string>>("queue<string>", n);
+  loopVsRange<s21::stack<int, s21::Vector<int>>>("stack<int, Vector>", n);
+  loopVsRange<s21::stack<int>>("stack<int>", n);
+  loopVsRange<s21::queue<int>>("queue<int>", n);
+  return 0;
+}
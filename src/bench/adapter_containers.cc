@@ -0,0 +1,59 @@
+// s21::stack и s21::queue поверх разных контейнеров: n вставок, затем n
+// удалений, лучшее время из трёх прогонов.
+// Запуск: ./bench/adapter_containers [n]
+#include "../s21_deque.h"
+#include "../s21_list.h"
+#include "../s21_queue.h"
+#include "../s21_ring_buffer.h"
+#include "../s21_stack.h"
+#include "../s21_vector.h"
+#include "bench.h"
+
+template <typename Adapter, typename Pop>
+void run(const char *name, std::size_t n, Pop pop, bool print) {
+  double ms = 0;
+  for (int round = 0; round < 3; ++round) {
+    Adapter adapter;
+    double round_ms = bench::measure([&] {
+      for (std::size_t i = 0; i < n; ++i) adapter.push(static_cast<int>(i));
+      long long sum = 0;
+      while (!adapter.empty()) sum += pop(adapter);
+      bench::keep(sum);
+    });
+    if (round == 0 || round_ms < ms) ms = round_ms;
+  }
+  if (print) std::printf("%-30s %10.2f ms\n", name, ms);
+}
+
+int main(int argc, char **argv) {
+  const std::size_t n = bench::sizeArg(argc, argv, 1000000);
+  auto pop_top = [](auto &stack) {
+    int value = stack.top();
+    stack.pop();
+    return value;
+  };
+  auto pop_front = [](auto &queue) {
+    int value = queue.front();
+    queue.pop();
+    return value;
+  };
+  std::printf("n = %zu\n", n);
+  // Первый проход не печатается: он прогревает кучу, иначе первая строка
+  // платит за первые обращения к свежей памяти.
+  for (int pass = 0; pass < 2; ++pass) {
+    const bool print = pass == 1;
+    run<s21::stack<int>>("stack<s21::Vector> (default)", n, pop_top, print);
+    run<s21::stack<int, s21::deque<int>>>("stack<s21::deque>", n, pop_top,
+                                          print);
+    run<s21::stack<int, s21::ring_buffer<int>>>("stack<s21::ring_buffer>", n,
+                                                pop_top, print);
+    run<s21::stack<int, S21::List<int>>>("stack<S21::List>", n, pop_top,
+                                         print);
+    run<s21::queue<int>>("queue<s21::deque> (default)", n, pop_front, print);
+    run<s21::queue<int, s21::ring_buffer<int>>>("queue<s21::ring_buffer>", n,
+                                                pop_front, print);
+    run<s21::queue<int, S21::List<int>>>("queue<S21::List>", n, pop_front,
+                                         print);
+  }
+  return 0;
+}
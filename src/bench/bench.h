@@ -0,0 +1,32 @@
+#ifndef CONTAINERS_SRC_BENCH_BENCH_H_
+#define CONTAINERS_SRC_BENCH_BENCH_H_
+
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <cstdio>
+
+namespace bench {
+// Время выполнения fn в миллисекундах.
+template <typename Fn>
+double measure(Fn &&fn) {
+  auto start = std::chrono::steady_clock::now();
+  fn();
+  std::chrono::duration<double, std::milli> elapsed =
+      std::chrono::steady_clock::now() - start;
+  return elapsed.count();
+}
+
+// Размер задачи из первого аргумента командной строки.
+inline std::size_t sizeArg(int argc, char **argv, std::size_t fallback) {
+  return argc > 1 ? std::strtoull(argv[1], nullptr, 10) : fallback;
+}
+
+// Не даёт компилятору выбросить вычисление результата.
+template <typename T>
+void keep(const T &value) {
+  asm volatile("" : : "r,m"(value) : "memory");
+}
+}  // namespace bench
+
+#endif  // CONTAINERS_SRC_BENCH_BENCH_H_
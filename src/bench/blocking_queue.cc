@@ -0,0 +1,94 @@
+// Конвейер: 4 производителя передают n int одному потребителю.
+// blocking_queue::pop по одному, blocking_queue::pop_all пачками и
+// s21::queue под мьютексом с одной condition_variable на всё, будящей всех.
+// Запуск: ./bench/blocking_queue [n]
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "../s21_blocking_queue.h"
+#include "../s21_queue.h"
+#include "bench.h"
+
+namespace {
+constexpr int kProducers = 4;
+constexpr std::size_t kCapacity = 1024;
+
+// Типичная самодельная обёртка: notify_all на любое изменение.
+class NaiveQueue {
+ public:
+  void push(int value) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    changed_.wait(lock, [this] { return queue_.size() < kCapacity; });
+    queue_.push(value);
+    changed_.notify_all();
+  }
+  int pop() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    changed_.wait(lock, [this] { return !queue_.empty(); });
+    int value = queue_.front();
+    queue_.pop();
+    changed_.notify_all();
+    return value;
+  }
+
+ private:
+  std::mutex mutex_;
+  std::condition_variable changed_;
+  s21::queue<int> queue_;
+};
+
+template <typename Push, typename Consume>
+void run(const char *name, std::size_t n, Push push, Consume consume) {
+  long long sum = 0;
+  double ms = bench::measure([&] {
+    std::vector<std::thread> producers;
+    for (int p = 0; p < kProducers; ++p)
+      producers.emplace_back([&, p] {
+        for (std::size_t i = p; i < n; i += kProducers)
+          push(static_cast<int>(i));
+      });
+    for (std::size_t received = 0; received < n;) received += consume(sum);
+    for (auto &producer : producers) producer.join();
+  });
+  bench::keep(sum);
+  std::printf("%-26s %10.2f ms\n", name, ms);
+}
+}  // namespace
+
+int main(int argc, char **argv) {
+  const std::size_t n = bench::sizeArg(argc, argv, 2000000);
+  std::printf("n = %zu, producers = %d, hardware threads = %u\n", n,
+              kProducers, std::thread::hardware_concurrency());
+
+  s21::blocking_queue<int> single(kCapacity);
+  run(
+      "blocking_queue::pop", n, [&](int value) { single.push(value); },
+      [&](long long &sum) {
+        int value = 0;
+        single.pop(value);
+        sum += value;
+        return std::size_t{1};
+      });
+
+  s21::blocking_queue<int> batched(kCapacity);
+  s21::Vector<int> batch;
+  run(
+      "blocking_queue::pop_all", n, [&](int value) { batched.push(value); },
+      [&](long long &sum) {
+        batch.clear();
+        const std::size_t count = batched.pop_all(batch);
+        for (std::size_t i = 0; i < count; ++i) sum += batch[i];
+        return count;
+      });
+
+  NaiveQueue naive;
+  run(
+      "mutex + cv + s21::queue", n, [&](int value) { naive.push(value); },
+      [&](long long &sum) {
+        sum += naive.pop();
+        return std::size_t{1};
+      });
+  return 0;
+}
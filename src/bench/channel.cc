@@ -0,0 +1,59 @@
+// Пропускная способность: n int от производителя к потребителю.
+// s21::channel между двумя сопрограммами на одном потоке против
+// s21::blocking_queue (мьютекс и condition_variable) между двумя потоками.
+// Собирается как C++20. Запуск: ./bench/channel [n]
+#include <thread>
+
+#include "../s21_blocking_queue.h"
+#include "../s21_channel.h"
+#include "bench.h"
+
+namespace {
+constexpr std::size_t kCapacity = 1024;
+
+s21::detached_task produce(s21::channel<int> &channel, std::size_t n) {
+  for (std::size_t i = 0; i < n; ++i)
+    co_await channel.push(static_cast<int>(i));
+  channel.close();
+}
+
+s21::detached_task consume(s21::channel<int> &channel, long long &sum) {
+  while (auto value = co_await channel.pop()) sum += *value;
+}
+}  // namespace
+
+int main(int argc, char **argv) {
+  const std::size_t n = bench::sizeArg(argc, argv, 10000000);
+  std::printf("n = %zu, capacity = %zu, hardware threads = %u\n", n,
+              kCapacity, std::thread::hardware_concurrency());
+
+  for (std::size_t capacity : {std::size_t{0}, kCapacity}) {
+    s21::manual_executor executor;
+    s21::channel<int> channel(capacity, executor);
+    long long sum = 0;
+    double ms = bench::measure([&] {
+      produce(channel, n).start(executor);
+      consume(channel, sum).start(executor);
+      executor.run();
+    });
+    bench::keep(sum);
+    std::printf("channel, capacity %-10zu %10.2f ms %8.2f Mmsg/s\n",
+                capacity, ms, n / ms / 1000.0);
+  }
+
+  s21::blocking_queue<int> queue(kCapacity);
+  long long sum = 0;
+  double ms = bench::measure([&] {
+    std::thread producer([&] {
+      for (std::size_t i = 0; i < n; ++i) queue.push(static_cast<int>(i));
+      queue.close();
+    });
+    int value;
+    while (queue.pop(value)) sum += value;
+    producer.join();
+  });
+  bench::keep(sum);
+  std::printf("%-28s %10.2f ms %8.2f Mmsg/s\n", "blocking_queue, 2 threads", ms,
+              n / ms / 1000.0);
+  return 0;
+}
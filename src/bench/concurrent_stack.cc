@@ -0,0 +1,69 @@
+// Конкуренция за стек: 1..32 потока, каждый делает n / threads пар
+// push + try_pop. s21::concurrent_stack против s21::stack под мьютексом.
+// Запуск: ./bench/concurrent_stack [n]
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "../s21_concurrent_stack.h"
+#include "../s21_stack.h"
+#include "bench.h"
+
+namespace {
+class LockedStack {
+ public:
+  void push(int value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stack_.push(value);
+  }
+  bool try_pop(int &out) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (stack_.empty()) return false;
+    out = stack_.top();
+    stack_.pop();
+    return true;
+  }
+
+ private:
+  std::mutex mutex_;
+  s21::stack<int> stack_;
+};
+
+template <typename Stack>
+double run(Stack &stack, std::size_t n, unsigned threads) {
+  std::atomic<long long> sum{0};
+  double ms = bench::measure([&] {
+    std::vector<std::thread> pool;
+    for (unsigned t = 0; t < threads; ++t)
+      pool.emplace_back([&, t] {
+        long long local = 0;
+        int value = 0;
+        for (std::size_t i = t; i < n; i += threads) {
+          stack.push(static_cast<int>(i));
+          if (stack.try_pop(value)) local += value;
+        }
+        sum += local;
+      });
+    for (auto &thread : pool) thread.join();
+  });
+  bench::keep(sum.load());
+  return ms;
+}
+}  // namespace
+
+int main(int argc, char **argv) {
+  const std::size_t n = bench::sizeArg(argc, argv, 2000000);
+  std::printf("n = %zu, hardware threads = %u\n", n,
+              std::thread::hardware_concurrency());
+  std::printf("%8s %18s %14s\n", "threads", "concurrent_stack",
+              "mutex+stack");
+  for (unsigned threads = 1; threads <= 32; threads *= 2) {
+    s21::concurrent_stack<int> lock_free;
+    LockedStack locked;
+    double lock_free_ms = run(lock_free, n, threads);
+    double locked_ms = run(locked, n, threads);
+    std::printf("%8u %15.2f ms %11.2f ms\n", threads, lock_free_ms, locked_ms);
+  }
+  return 0;
+}
@@ -0,0 +1,56 @@
+// s21::deque против std::deque: вставки и удаления с обоих концов,
+// произвольный доступ и обход. Каждый контейнер прогоняется дважды,
+// печатается второй прогон. Запуск: ./bench/deque [n]
+#include <deque>
+#include <random>
+#include <vector>
+
+#include "../s21_deque.h"
+#include "bench.h"
+
+template <typename Deque>
+void round(const char *name, std::size_t n,
+           const std::vector<std::size_t> &at) {
+  Deque deque;
+  double push_ms = bench::measure([&] {
+    for (std::size_t i = 0; i < n; ++i) {
+      deque.push_back(static_cast<int>(i));
+      deque.push_front(static_cast<int>(i));
+    }
+  });
+  long long sum = 0;
+  double random_ms = bench::measure([&] {
+    for (std::size_t index : at) sum += deque[index];
+  });
+  double scan_ms = bench::measure([&] {
+    for (auto it = deque.begin(); it != deque.end(); ++it) sum += *it;
+  });
+  double pop_ms = bench::measure([&] {
+    while (!deque.empty()) {
+      deque.pop_back();
+      if (!deque.empty()) deque.pop_front();
+    }
+  });
+  bench::keep(sum);
+  if (name)
+    std::printf("%-12s %10.2f %10.2f %10.2f %10.2f\n", name, push_ms,
+                random_ms, scan_ms, pop_ms);
+}
+
+template <typename Deque>
+void run(const char *name, std::size_t n, const std::vector<std::size_t> &at) {
+  round<Deque>(nullptr, n, at);
+  round<Deque>(name, n, at);
+}
+
+int main(int argc, char **argv) {
+  const std::size_t n = bench::sizeArg(argc, argv, 1000000);
+  std::vector<std::size_t> at(n);
+  std::mt19937 rng(42);
+  for (auto &index : at) index = rng() % (2 * n);
+  std::printf("n = %zu per end, ms\n%-12s %10s %10s %10s %10s\n", n, "",
+              "push", "random", "scan", "pop");
+  run<s21::deque<int>>("s21::deque", n, at);
+  run<std::deque<int>>("std::deque", n, at);
+  return 0;
+}
@@ -0,0 +1,33 @@
+// Масштабирование S21::parallel_sort по числу потоков на случайных
+// данных. Запуск: ./bench/list_parallel_sort [n]
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "../s21_list_parallel_sort.h"
+#include "bench.h"
+
+int main(int argc, char **argv) {
+  const std::size_t n = bench::sizeArg(argc, argv, 5000000);
+  std::vector<int> random(n);
+  std::mt19937 gen(42);
+  for (auto &value : random) value = static_cast<int>(gen());
+
+  std::printf("n = %zu, hardware threads = %u\n%-8s %12s %10s\n", n,
+              std::thread::hardware_concurrency(), "threads", "ms", "speedup");
+  double baseline = 0;
+  for (std::size_t threads = 1; threads <= 16; threads *= 2) {
+    S21::List<int> list;
+    for (int value : random) list.push_back(value);
+    double ms = bench::measure([&] {
+      if (threads == 1)
+        list.sort();
+      else
+        S21::parallel_sort(list, threads);
+    });
+    if (threads == 1) baseline = ms;
+    bench::keep(list.front());
+    std::printf("%-8zu %12.2f %9.2fx\n", threads, ms, baseline / ms);
+  }
+  return 0;
+}
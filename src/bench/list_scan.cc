@@ -0,0 +1,47 @@
+// Обход S21::List, узлы которого разбросаны по памяти: список строится из
+// случайной перестановки и сортируется, так что порядок списка не совпадает
+// с порядком узлов в памяти. Сравниваются обход итератором, accumulate и оба
+// обхода после relayout().
+// Запуск: ./bench/list_scan [n]
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "../s21_list.h"
+#include "bench.h"
+
+namespace {
+double iterate(S21::List<int> &list, long long &sum) {
+  return bench::measure([&] {
+    for (auto it = list.begin(); it != list.end(); ++it) sum += *it;
+  });
+}
+
+double accumulate(const S21::List<int> &list, long long &sum) {
+  return bench::measure([&] { sum += list.accumulate(0LL); });
+}
+
+void report(const char *name, double ms, std::size_t n) {
+  std::printf("%-22s %10.2f ms %8.1f Mnodes/s\n", name, ms, n / ms / 1000.0);
+}
+}  // namespace
+
+int main(int argc, char **argv) {
+  const std::size_t n = bench::sizeArg(argc, argv, 10000000);
+  std::vector<int> values(n);
+  for (std::size_t i = 0; i < n; ++i) values[i] = static_cast<int>(i);
+  std::shuffle(values.begin(), values.end(), std::mt19937(42));
+  S21::List<int> list;
+  for (int value : values) list.push_back(value);
+  list.sort();
+
+  long long sum = 0;
+  std::printf("n = %zu\n", n);
+  report("scattered, iterator", iterate(list, sum), n);
+  report("scattered, accumulate", accumulate(list, sum), n);
+  report("relayout", bench::measure([&] { list.relayout(); }), n);
+  report("packed, iterator", iterate(list, sum), n);
+  report("packed, accumulate", accumulate(list, sum), n);
+  bench::keep(sum);
+  return 0;
+}
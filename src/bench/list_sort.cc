@@ -0,0 +1,41 @@
+// Сортировка S21::List против std::list на упорядоченных, обратных и
+// случайных данных. Запуск: ./bench/list_sort [n]
+#include <list>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "../s21_list.h"
+#include "bench.h"
+
+template <typename ListType>
+void fill(ListType &list, const std::vector<int> &values) {
+  for (int value : values) list.push_back(value);
+}
+
+int main(int argc, char **argv) {
+  const std::size_t n = bench::sizeArg(argc, argv, 1000000);
+  std::vector<int> sorted(n), reversed(n), random(n);
+  std::mt19937 gen(42);
+  for (std::size_t i = 0; i < n; ++i) {
+    sorted[i] = static_cast<int>(i);
+    reversed[i] = static_cast<int>(n - i);
+    random[i] = static_cast<int>(gen());
+  }
+  const std::pair<const char *, const std::vector<int> *> inputs[] = {
+      {"sorted", &sorted}, {"reversed", &reversed}, {"random", &random}};
+
+  std::printf("n = %zu\n%-10s %14s %14s\n", n, "input", "S21::List ms",
+              "std::list ms");
+  for (const auto &input : inputs) {
+    S21::List<int> s21_list;
+    std::list<int> std_list;
+    fill(s21_list, *input.second);
+    fill(std_list, *input.second);
+    double s21_ms = bench::measure([&] { s21_list.sort(); });
+    double std_ms = bench::measure([&] { std_list.sort(); });
+    bench::keep(s21_list.front());
+    std::printf("%-10s %14.2f %14.2f\n", input.first, s21_ms, std_ms);
+  }
+  return 0;
+}
@@ -0,0 +1,76 @@
+// S21::lru_cache против наивного LRU на S21::List с линейным поиском.
+// Запуск: ./bench/lru_cache [capacity]
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "../s21_containersplus.h"
+#include "../s21_list.h"
+#include "bench.h"
+
+namespace {
+// Наивный LRU: пары ключ-значение в S21::List, каждое обращение ищет ключ
+// линейным проходом и переносит узел в начало.
+class NaiveLru {
+ public:
+  explicit NaiveLru(std::size_t capacity) : capacity_(capacity) {}
+
+  int *get(int key) {
+    for (auto it = entries_.begin(); it != entries_.end(); ++it) {
+      if (it->first == key) {
+        entries_.splice(entries_.begin(), entries_, it);
+        return &it->second;
+      }
+    }
+    return nullptr;
+  }
+
+  void put(int key, int value) {
+    if (int *old = get(key)) {
+      *old = value;
+      return;
+    }
+    if (entries_.size() == capacity_) entries_.pop_back();
+    entries_.emplace_front(key, value);
+  }
+
+ private:
+  std::size_t capacity_;
+  S21::List<std::pair<int, int>> entries_;
+};
+
+template <typename Cache>
+double run(Cache &cache, const std::vector<int> &keys, long long &sum) {
+  return bench::measure([&] {
+    for (int key : keys) {
+      if (int *value = cache.get(key))
+        sum += *value;
+      else
+        cache.put(key, key);
+    }
+  });
+}
+}  // namespace
+
+int main(int argc, char **argv) {
+  const std::size_t capacity = bench::sizeArg(argc, argv, 1000);
+  const std::size_t operations = 200000;
+  // Ключей вдвое больше ёмкости, горячая четверть получает большую часть
+  // обращений.
+  std::mt19937 rng(42);
+  std::uniform_int_distribution<int> hot(0, static_cast<int>(capacity / 2));
+  std::uniform_int_distribution<int> any(0, static_cast<int>(capacity * 2));
+  std::vector<int> keys(operations);
+  for (auto &key : keys) key = rng() % 4 ? hot(rng) : any(rng);
+
+  S21::lru_cache<int, int> cache(capacity);
+  NaiveLru naive(capacity);
+  long long sum = 0;
+  std::printf("capacity = %zu, %zu operations\n", capacity, operations);
+  std::printf("%-16s %10.2f ms\n", "naive List", run(naive, keys, sum));
+  std::printf("%-16s %10.2f ms\n", "lru_cache", run(cache, keys, sum));
+  std::printf("hit rate %.1f%%\n",
+              100.0 * cache.stats().hits / static_cast<double>(operations));
+  bench::keep(sum);
+  return 0;
+}
@@ -0,0 +1,96 @@
+// Конкуренция за очередь: 1..32 потока, половина производителей и половина
+// потребителей (при одном потоке он сначала кладёт, потом забирает).
+// s21::mpmc_queue против s21::queue под мьютексом, вместе n сообщений.
+// Запуск: ./bench/mpmc_queue [n]
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "../s21_mpmc_queue.h"
+#include "../s21_queue.h"
+#include "bench.h"
+
+namespace {
+class LockedQueue {
+ public:
+  bool try_push(int value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    queue_.push(value);
+    return true;
+  }
+  bool try_pop(int &out) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (queue_.empty()) return false;
+    out = queue_.front();
+    queue_.pop();
+    return true;
+  }
+
+ private:
+  std::mutex mutex_;
+  s21::queue<int> queue_;
+};
+
+template <typename Queue>
+double run(Queue &queue, std::size_t n, unsigned threads) {
+  std::atomic<long long> sum{0};
+  double ms = bench::measure([&] {
+    if (threads == 1) {
+      long long local = 0;
+      int value = 0;
+      for (std::size_t done = 0; done < n;) {
+        std::size_t i = done;
+        while (i < n && queue.try_push(static_cast<int>(i))) ++i;
+        for (; done < i; ++done) {
+          queue.try_pop(value);
+          local += value;
+        }
+      }
+      sum += local;
+      return;
+    }
+    const unsigned producers = threads / 2, consumers = threads - producers;
+    std::atomic<std::size_t> received{0};
+    std::vector<std::thread> pool;
+    for (unsigned p = 0; p < producers; ++p)
+      pool.emplace_back([&, p] {
+        s21::spin_wait waiter;
+        for (std::size_t i = p; i < n; i += producers)
+          while (!queue.try_push(static_cast<int>(i))) waiter.wait();
+      });
+    for (unsigned c = 0; c < consumers; ++c)
+      pool.emplace_back([&] {
+        long long local = 0;
+        int value = 0;
+        while (received.load(std::memory_order_relaxed) < n) {
+          if (!queue.try_pop(value)) {
+            std::this_thread::yield();
+            continue;
+          }
+          local += value;
+          received.fetch_add(1, std::memory_order_relaxed);
+        }
+        sum += local;
+      });
+    for (auto &thread : pool) thread.join();
+  });
+  bench::keep(sum.load());
+  return ms;
+}
+}  // namespace
+
+int main(int argc, char **argv) {
+  const std::size_t n = bench::sizeArg(argc, argv, 2000000);
+  std::printf("n = %zu, hardware threads = %u\n", n,
+              std::thread::hardware_concurrency());
+  std::printf("%8s %14s %14s\n", "threads", "mpmc_queue", "mutex+queue");
+  for (unsigned threads = 1; threads <= 32; threads *= 2) {
+    s21::mpmc_queue<int> lock_free(1024);
+    LockedQueue locked;
+    double lock_free_ms = run(lock_free, n, threads);
+    double locked_ms = run(locked, n, threads);
+    std::printf("%8u %11.2f ms %11.2f ms\n", threads, lock_free_ms, locked_ms);
+  }
+  return 0;
+}
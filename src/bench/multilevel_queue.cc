@@ -0,0 +1,82 @@
+// Планировщик с 64 классами приоритета: очереди заполнены только на
+// младших уровнях. Линейный опрос массива s21::queue против
+// s21::multilevel_queue (строгий приоритет и взвешенная выборка).
+// Запуск: ./bench/multilevel_queue [n]
+#include <random>
+#include <vector>
+
+#include "../s21_multilevel_queue.h"
+#include "../s21_queue.h"
+#include "bench.h"
+
+namespace {
+constexpr std::size_t kLevels = 64;
+
+// Уровни 48..63: большинство запросов низкоприоритетные.
+std::vector<std::size_t> makeLevels(std::size_t n) {
+  std::mt19937 gen(7);
+  std::vector<std::size_t> levels(n);
+  for (auto &level : levels) level = 48 + gen() % 16;
+  return levels;
+}
+
+// Каждый шаг кладёт один запрос и обслуживает один, в очереди держится
+// около 1000 запросов.
+template <typename Push, typename Pop>
+double run(const std::vector<std::size_t> &levels, Push push, Pop pop) {
+  long long sum = 0;
+  double ms = bench::measure([&] {
+    std::size_t i = 0;
+    for (; i < 1000; ++i) push(levels[i], static_cast<int>(i));
+    for (; i < levels.size(); ++i) {
+      push(levels[i], static_cast<int>(i));
+      sum += pop();
+    }
+  });
+  bench::keep(sum);
+  return ms;
+}
+}  // namespace
+
+int main(int argc, char **argv) {
+  const std::size_t n = bench::sizeArg(argc, argv, 5000000);
+  const std::vector<std::size_t> levels = makeLevels(n);
+  std::printf("n = %zu, levels = %zu\n", n, kLevels);
+
+  std::vector<s21::queue<int>> polled(kLevels);
+  double polled_ms = run(
+      levels, [&](std::size_t level, int value) { polled[level].push(value); },
+      [&] {
+        for (auto &queue : polled)
+          if (!queue.empty()) {
+            int value = queue.front();
+            queue.pop();
+            return value;
+          }
+        return 0;
+      });
+  std::printf("%-28s %10.2f ms\n", "linear poll of s21::queue", polled_ms);
+
+  s21::multilevel_queue<int, kLevels> strict;
+  double strict_ms = run(
+      levels, [&](std::size_t level, int value) { strict.push(level, value); },
+      [&] {
+        int value = 0;
+        strict.pop(value);
+        return value;
+      });
+  std::printf("%-28s %10.2f ms\n", "multilevel_queue::pop", strict_ms);
+
+  s21::multilevel_queue<int, kLevels> fair;
+  for (std::size_t level = 0; level < kLevels; ++level)
+    fair.set_weight(level, kLevels - level);
+  double fair_ms = run(
+      levels, [&](std::size_t level, int value) { fair.push(level, value); },
+      [&] {
+        int value = 0;
+        fair.pop_fair(value);
+        return value;
+      });
+  std::printf("%-28s %10.2f ms\n", "multilevel_queue::pop_fair", fair_ms);
+  return 0;
+}
@@ -0,0 +1,65 @@
+// Рекурсивная сумма s21::Vector по схеме fork/join: последовательно,
+// через thread_pool::parallel_invoke с разными порогами дробления и через
+// std::thread на каждое ветвление до глубины 4.
+// Запуск: ./bench/parallel_invoke [n]
+#include <thread>
+
+#include "../s21_thread_pool.h"
+#include "../s21_vector.h"
+#include "bench.h"
+
+namespace {
+using Vector = s21::Vector<long long>;
+
+long long sequential(const long long *data, std::size_t n) {
+  long long sum = 0;
+  for (std::size_t i = 0; i < n; ++i) sum += data[i] * data[i] % 7;
+  return sum;
+}
+
+long long pooled(s21::thread_pool &pool, const long long *data,
+                 std::size_t n, std::size_t grain) {
+  if (n <= grain) return sequential(data, n);
+  long long left = 0, right = 0;
+  pool.parallel_invoke([&] { left = pooled(pool, data, n / 2, grain); },
+                       [&] {
+                         right = pooled(pool, data + n / 2, n - n / 2, grain);
+                       });
+  return left + right;
+}
+
+long long spawned(const long long *data, std::size_t n, int depth) {
+  if (depth == 0) return sequential(data, n);
+  long long right = 0;
+  std::thread thread(
+      [&] { right = spawned(data + n / 2, n - n / 2, depth - 1); });
+  long long left = spawned(data, n / 2, depth - 1);
+  thread.join();
+  return left + right;
+}
+}  // namespace
+
+int main(int argc, char **argv) {
+  const std::size_t n = bench::sizeArg(argc, argv, 20000000);
+  Vector values(n);
+  for (std::size_t i = 0; i < n; ++i) values[i] = static_cast<long long>(i);
+  const long long *data = values.data();
+  s21::thread_pool &pool = s21::thread_pool::shared();
+  std::printf("n = %zu, pool threads = %zu\n", n, pool.size());
+
+  long long sum = 0;
+  double ms = bench::measure([&] { sum = sequential(data, n); });
+  std::printf("%-30s %10.2f ms\n", "sequential", ms);
+  for (std::size_t grain : {n / 8, std::size_t{1} << 16, std::size_t{4096}}) {
+    long long result = 0;
+    ms = bench::measure([&] { result = pooled(pool, data, n, grain); });
+    std::printf("parallel_invoke, grain %-7zu %10.2f ms%s\n", grain, ms,
+                result == sum ? "" : "  MISMATCH");
+  }
+  long long result = 0;
+  ms = bench::measure([&] { result = spawned(data, n, 4); });
+  std::printf("%-30s %10.2f ms%s\n", "std::thread per fork, 16", ms,
+              result == sum ? "" : "  MISMATCH");
+  bench::keep(sum);
+  return 0;
+}
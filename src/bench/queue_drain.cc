@@ -0,0 +1,31 @@
+// Заполнение и опустошение s21::queue против std::queue.
+// Запуск: ./bench/queue_drain [n]
+#include <queue>
+
+#include "../s21_queue.h"
+#include "bench.h"
+
+template <typename Queue>
+void run(const char *name, std::size_t n) {
+  Queue queue;
+  double push_ms = bench::measure([&] {
+    for (std::size_t i = 0; i < n; ++i) queue.push(static_cast<int>(i));
+  });
+  long long sum = 0;
+  double pop_ms = bench::measure([&] {
+    while (!queue.empty()) {
+      sum += queue.front();
+      queue.pop();
+    }
+  });
+  bench::keep(sum);
+  std::printf("%-12s %10.2f %10.2f\n", name, push_ms, pop_ms);
+}
+
+int main(int argc, char **argv) {
+  const std::size_t n = bench::sizeArg(argc, argv, 1000000);
+  std::printf("n = %zu\n%-12s %10s %10s\n", n, "", "push ms", "pop ms");
+  run<s21::queue<int>>("s21::queue", n);
+  run<std::queue<int>>("std::queue", n);
+  return 0;
+}
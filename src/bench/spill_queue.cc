@@ -0,0 +1,53 @@
+// Всплеск: n int кладутся подряд, затем вычитываются. s21::queue держит всё
+// в памяти, spill_queue — не больше 64K элементов, остальное на диске.
+// Пиковая память процесса (maxrss) снимается после каждого прогона, поэтому
+// spill_queue идёт первым.
+// Запуск: ./bench/spill_queue [n] [каталог]
+#include <sys/resource.h>
+
+#include <string>
+
+#include "../s21_queue.h"
+#include "../s21_spill_queue.h"
+#include "bench.h"
+
+namespace {
+long maxRssMb() {
+  rusage usage;
+  getrusage(RUSAGE_SELF, &usage);
+  return usage.ru_maxrss / 1024;
+}
+
+template <typename Queue>
+void run(const char *name, Queue &queue, std::size_t n) {
+  long long sum = 0;
+  double push_ms = bench::measure([&] {
+    for (std::size_t i = 0; i < n; ++i) queue.push(static_cast<int>(i));
+  });
+  double pop_ms = bench::measure([&] {
+    while (!queue.empty()) {
+      sum += queue.front();
+      queue.pop();
+    }
+  });
+  bench::keep(sum);
+  std::printf("%-12s push %9.2f ms  pop %9.2f ms  maxrss %5ld MB\n", name,
+              push_ms, pop_ms, maxRssMb());
+}
+}  // namespace
+
+int main(int argc, char **argv) {
+  const std::size_t n = bench::sizeArg(argc, argv, 50000000);
+  const std::string directory = argc > 2 ? argv[2] : "/tmp";
+  std::printf("n = %zu, spill directory %s, start maxrss %ld MB\n", n,
+              directory.c_str(), maxRssMb());
+  {
+    s21::spill_queue<int> spill(directory);
+    run("spill_queue", spill, n);
+  }
+  {
+    s21::queue<int> memory;
+    run("s21::queue", memory, n);
+  }
+  return 0;
+}
@@ -0,0 +1,126 @@
+// Пропускная способность передачи int между двумя потоками: spsc_queue по
+// одному элементу и пачками против s21::queue под мьютексом. На Linux потоки
+// закрепляются за ядрами 0 и 1, если ядер хотя бы два.
+// Запуск: ./bench/spsc_queue [n]
+#include <algorithm>
+#include <mutex>
+#include <thread>
+
+#ifdef __linux__
+#include <pthread.h>
+#endif
+
+#include "../s21_queue.h"
+#include "../s21_spsc_queue.h"
+#include "bench.h"
+
+namespace {
+void pinToCore(unsigned core) {
+#ifdef __linux__
+  if (std::thread::hardware_concurrency() < 2) return;
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  CPU_SET(core, &set);
+  pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+#else
+  (void)core;
+#endif
+}
+
+class LockedQueue {
+ public:
+  void push(int value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    queue_.push(value);
+  }
+  bool try_pop(int &out) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (queue_.empty()) return false;
+    out = queue_.front();
+    queue_.pop();
+    return true;
+  }
+
+ private:
+  std::mutex mutex_;
+  s21::queue<int> queue_;
+};
+
+// producer(i) кладёт i-й элемент, consumer() возвращает сколько забрал.
+template <typename Producer, typename Consumer>
+void run(const char *name, std::size_t n, Producer producer,
+         Consumer consumer) {
+  long long sum = 0;
+  double ms = bench::measure([&] {
+    std::thread thread([&] {
+      pinToCore(1);
+      for (std::size_t i = 0; i < n;) i += producer(i);
+    });
+    pinToCore(0);
+    for (std::size_t received = 0; received < n;)
+      received += consumer(sum);
+    thread.join();
+  });
+  bench::keep(sum);
+  std::printf("%-20s %10.2f ms %8.2f Mmsg/s\n", name, ms, n / ms / 1000.0);
+}
+}  // namespace
+
+int main(int argc, char **argv) {
+  const std::size_t n = bench::sizeArg(argc, argv, 10000000);
+  constexpr std::size_t kBatch = 64;
+  std::printf("n = %zu, hardware threads = %u\n", n,
+              std::thread::hardware_concurrency());
+
+  s21::spsc_queue<int> single(4096);
+  run(
+      "spsc_queue", n,
+      [&](std::size_t i) {
+        single.push(static_cast<int>(i));
+        return std::size_t{1};
+      },
+      [&](long long &sum) {
+        int value;
+        single.pop(value);
+        sum += value;
+        return std::size_t{1};
+      });
+
+  s21::spsc_queue<int> batched(4096);
+  run(
+      "spsc_queue, batch 64", n,
+      [&](std::size_t i) {
+        int batch[kBatch];
+        std::size_t count = std::min(kBatch, n - i);
+        for (std::size_t j = 0; j < count; ++j)
+          batch[j] = static_cast<int>(i + j);
+        std::size_t pushed = batched.push_n(batch, count);
+        if (!pushed) std::this_thread::yield();
+        return pushed;
+      },
+      [&](long long &sum) {
+        int batch[kBatch];
+        std::size_t count = batched.pop_n(batch, kBatch);
+        if (!count) std::this_thread::yield();
+        for (std::size_t j = 0; j < count; ++j) sum += batch[j];
+        return count;
+      });
+
+  LockedQueue locked;
+  run(
+      "mutex + s21::queue", n,
+      [&](std::size_t i) {
+        locked.push(static_cast<int>(i));
+        return std::size_t{1};
+      },
+      [&](long long &sum) {
+        int value;
+        if (!locked.try_pop(value)) {
+          std::this_thread::yield();
+          return std::size_t{0};
+        }
+        sum += value;
+        return std::size_t{1};
+      });
+  return 0;
+}
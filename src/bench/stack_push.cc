@@ -0,0 +1,27 @@
+// Заполнение и опустошение s21::stack против std::stack.
+// Запуск: ./bench/stack_push [n]
+#include <stack>
+
+#include "../s21_stack.h"
+#include "bench.h"
+
+template <typename Stack>
+void run(const char *name, std::size_t n) {
+  Stack stack;
+  double push_ms = bench::measure([&] {
+    for (std::size_t i = 0; i < n; ++i) stack.push(static_cast<int>(i));
+  });
+  bench::keep(stack.top());
+  double pop_ms = bench::measure([&] {
+    for (std::size_t i = 0; i < n; ++i) stack.pop();
+  });
+  std::printf("%-12s %10.2f %10.2f\n", name, push_ms, pop_ms);
+}
+
+int main(int argc, char **argv) {
+  const std::size_t n = bench::sizeArg(argc, argv, 1000000);
+  std::printf("n = %zu\n%-12s %10s %10s\n", n, "", "push ms", "pop ms");
+  run<s21::stack<int>>("s21::stack", n);
+  run<std::stack<int>>("std::stack", n);
+  return 0;
+}
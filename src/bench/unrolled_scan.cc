@@ -0,0 +1,34 @@
+// Последовательный обход S21::unrolled_list против S21::List и s21::Vector.
+// Запуск: ./bench/unrolled_scan [n]
+#include "../s21_containersplus.h"
+#include "../s21_list.h"
+#include "../s21_vector.h"
+#include "bench.h"
+
+template <typename Container>
+double scan(Container &container, long long &sum) {
+  return bench::measure([&] {
+    for (int round = 0; round < 10; ++round)
+      for (auto it = container.begin(); it != container.end(); ++it)
+        sum += *it;
+  });
+}
+
+int main(int argc, char **argv) {
+  const std::size_t n = bench::sizeArg(argc, argv, 1000000);
+  s21::Vector<int> vector;
+  S21::List<int> list;
+  S21::unrolled_list<int> unrolled;
+  for (std::size_t i = 0; i < n; ++i) {
+    vector.push_back(static_cast<int>(i));
+    list.push_back(static_cast<int>(i));
+    unrolled.push_back(static_cast<int>(i));
+  }
+  long long sum = 0;
+  std::printf("n = %zu, 10 passes\n", n);
+  std::printf("%-16s %10.2f ms\n", "s21::Vector", scan(vector, sum));
+  std::printf("%-16s %10.2f ms\n", "S21::List", scan(list, sum));
+  std::printf("%-16s %10.2f ms\n", "unrolled_list", scan(unrolled, sum));
+  bench::keep(sum);
+  return 0;
+}
@@ -0,0 +1,43 @@
+#ifndef CONTAINERS_SRC_S21_ADAPTER_DETAIL_H_
+#define CONTAINERS_SRC_S21_ADAPTER_DETAIL_H_
+
+#include <algorithm>    // max
+#include <cstddef>      // size_t
+#include <iterator>     // distance iterator_traits
+#include <type_traits>  // void_t is_base_of_v
+#include <utility>      // declval
+
+namespace s21 {
+namespace adapter_detail {
+template <typename Container, typename = void>
+struct HasReserve : std::false_type {};
+
+template <typename Container>
+struct HasReserve<Container, std::void_t<decltype(std::declval<Container &>()
+                                                      .reserve(std::size_t{}))>>
+    : std::true_type {};
+
+// Готовит место ещё под extra элементов одним выделением, если контейнер
+// это умеет. deque и S21::List растут без переноса и reserve не имеют.
+// Рост не меньше чем вдвое: серия мелких пачек не копирует всё каждый раз.
+template <typename Container>
+void reserveMore(Container &container, std::size_t extra) {
+  if constexpr (HasReserve<Container>::value) {
+    const std::size_t needed = container.size() + extra;
+    if (needed > container.capacity())
+      container.reserve(std::max(needed, 2 * container.capacity()));
+  }
+}
+
+// Для прямых итераторов заранее известно число элементов.
+template <typename Container, typename InputIt>
+void reserveRange(Container &container, InputIt first, InputIt last) {
+  using Category = typename std::iterator_traits<InputIt>::iterator_category;
+  if constexpr (std::is_base_of_v<std::forward_iterator_tag, Category>)
+    reserveMore(container,
+                static_cast<std::size_t>(std::distance(first, last)));
+}
+}  // namespace adapter_detail
+}  // namespace s21
+
+#endif  // CONTAINERS_SRC_S21_ADAPTER_DETAIL_H_
@@ -0,0 +1,88 @@
+#ifndef CONTAINERS_SRC_S21_ARRAY_H_
+#define CONTAINERS_SRC_S21_ARRAY_H_
+
+#include <cstddef>           // size_t
+#include <initializer_list>  // initializer_list
+#include <stdexcept>         // out_of_range
+#include <utility>           // move
+
+namespace s21 {
+// Статический массив фиксированного размера. Все операции constexpr, поэтому
+// array можно заполнять и читать в константных выражениях.
+template <class T, std::size_t N>
+class array {
+ public:
+  using value_type = T;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using iterator = value_type *;
+  using const_iterator = const value_type *;
+  using size_type = std::size_t;
+
+  constexpr array() : data_{} {}
+  constexpr array(std::initializer_list<value_type> const &items) : data_{} {
+    if (items.size() > N) {
+      throw std::out_of_range("Too many initializers");
+    }
+    size_type i = 0;
+    for (const_reference item : items) data_[i++] = item;
+  }
+  constexpr array(const array &a) = default;
+  constexpr array(array &&a) noexcept = default;
+  ~array() = default;
+  constexpr array &operator=(const array &a) = default;
+  constexpr array &operator=(array &&a) noexcept = default;
+
+  constexpr reference at(size_type pos) {
+    if (pos >= N) {
+      throw std::out_of_range("Index out of range");
+    }
+    return data_[pos];
+  }
+  constexpr const_reference at(size_type pos) const {
+    if (pos >= N) {
+      throw std::out_of_range("Index out of range");
+    }
+    return data_[pos];
+  }
+  constexpr reference operator[](size_type pos) { return data_[pos]; }
+  constexpr const_reference operator[](size_type pos) const {
+    return data_[pos];
+  }
+  constexpr reference front() { return data_[0]; }
+  constexpr const_reference front() const { return data_[0]; }
+  constexpr reference back() { return data_[N - 1]; }
+  constexpr const_reference back() const { return data_[N - 1]; }
+  constexpr iterator data() { return data_; }
+  constexpr const_iterator data() const { return data_; }
+
+  constexpr iterator begin() { return data_; }
+  constexpr iterator end() { return data_ + N; }
+  constexpr const_iterator begin() const { return data_; }
+  constexpr const_iterator end() const { return data_ + N; }
+  constexpr const_iterator cbegin() const { return data_; }
+  constexpr const_iterator cend() const { return data_ + N; }
+
+  constexpr bool empty() const { return N == 0; }
+  constexpr size_type size() const { return N; }
+  constexpr size_type max_size() const { return N; }
+
+  constexpr void swap(array &other) {
+    for (size_type i = 0; i < N; ++i) {
+      value_type tmp = std::move(data_[i]);
+      data_[i] = std::move(other.data_[i]);
+      other.data_[i] = std::move(tmp);
+    }
+  }
+  constexpr void fill(const_reference value) {
+    for (size_type i = 0; i < N; ++i) data_[i] = value;
+  }
+
+ private:
+  // Массив нулевой длины запрещён стандартом, поэтому для N == 0 держим
+  // один неиспользуемый элемент; end() при этом всё равно равен begin().
+  value_type data_[N == 0 ? 1 : N];
+};
+}  // namespace s21
+
+#endif  // CONTAINERS_SRC_S21_ARRAY_H_
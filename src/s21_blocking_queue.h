@@ -0,0 +1,248 @@
+#ifndef CONTAINERS_SRC_S21_BLOCKING_QUEUE_H_
+#define CONTAINERS_SRC_S21_BLOCKING_QUEUE_H_
+
+#include <chrono>              // duration steady_clock
+#include <condition_variable>  // condition_variable
+#include <cstddef>             // size_t
+#include <memory>              // allocator
+#include <mutex>               // mutex unique_lock
+#include <new>                 // placement new
+#include <utility>             // forward move
+
+#include "s21_vector.h"
+
+namespace s21 {
+// Ограниченная блокирующая очередь для конвейеров производитель —
+// потребитель. Элементы лежат в собственном кольцевом буфере фиксированной
+// ёмкости, так что push и pop под мьютексом — O(1) без выделений памяти.
+//
+// Производители и потребители ждут на разных condition_variable. Будится
+// столько ждущих, сколько появилось мест или элементов, не считая уже
+// разбуженных, так что нет ни толпы проснувшихся, ни лишних системных
+// вызовов. Будят под мьютексом: на загруженной машине это дешевле.
+//
+// close() будит всех. После него push возвращает false, а pop отдаёт
+// оставшиеся элементы и возвращает false, когда очередь опустела.
+template <class T>
+class blocking_queue {
+ public:
+  using value_type = T;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using size_type = std::size_t;
+
+  explicit blocking_queue(size_type capacity)
+      : capacity_(capacity ? capacity : 1),
+        data_(std::allocator<value_type>().allocate(capacity_)) {}
+
+  blocking_queue(const blocking_queue &) = delete;
+  blocking_queue &operator=(const blocking_queue &) = delete;
+
+  ~blocking_queue() {
+    for (size_type i = 0; i < size_; ++i) slot(i)->~value_type();
+    std::allocator<value_type>().deallocate(data_, capacity_);
+  }
+
+  // Ждут свободного места. false — очередь закрыта, элемент не положен.
+  bool push(const_reference value) { return emplace(value); }
+  bool push(value_type &&value) { return emplace(std::move(value)); }
+
+  template <typename... Args>
+  bool emplace(Args &&...args) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    waitWhile(lock, producers_, [this] { return full(); });
+    return put(std::forward<Args>(args)...);
+  }
+
+  // Не ждут: false, если очередь полна или закрыта.
+  bool try_push(const_reference value) { return try_emplace(value); }
+  bool try_push(value_type &&value) { return try_emplace(std::move(value)); }
+
+  template <typename... Args>
+  bool try_emplace(Args &&...args) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (full()) return false;
+    return put(std::forward<Args>(args)...);
+  }
+
+  // Ждут не дольше timeout: false, если место не появилось или очередь
+  // закрыта.
+  template <class Rep, class Period>
+  bool push_for(const_reference value,
+                const std::chrono::duration<Rep, Period> &timeout) {
+    return pushUntil(value, std::chrono::steady_clock::now() + timeout);
+  }
+  template <class Rep, class Period>
+  bool push_for(value_type &&value,
+                const std::chrono::duration<Rep, Period> &timeout) {
+    return pushUntil(std::move(value),
+                     std::chrono::steady_clock::now() + timeout);
+  }
+
+  // Ждёт элемента. false — очередь закрыта и пуста.
+  bool pop(reference out) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    waitWhile(lock, consumers_, [this] { return size_ == 0; });
+    return take(out);
+  }
+
+  bool try_pop(reference out) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    return take(out);
+  }
+
+  template <class Rep, class Period>
+  bool pop_for(reference out,
+               const std::chrono::duration<Rep, Period> &timeout) {
+    const auto deadline = std::chrono::steady_clock::now() + timeout;
+    std::unique_lock<std::mutex> lock(mutex_);
+    waitUntil(lock, consumers_, [this] { return size_ == 0; }, deadline);
+    return take(out);
+  }
+
+  // Ждёт хотя бы одного элемента и переносит в out всё, что есть, за один
+  // захват мьютекса. Возвращает число перенесённых, 0 — очередь закрыта и
+  // пуста.
+  size_type pop_all(Vector<value_type> &out) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    waitWhile(lock, consumers_, [this] { return size_ == 0; });
+    return takeAll(out);
+  }
+
+  // То же без ожидания.
+  size_type drain_into(Vector<value_type> &out) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    return takeAll(out);
+  }
+
+  void close() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      closed_ = true;
+      producers_.notifyAll();
+      consumers_.notifyAll();
+    }
+  }
+
+  bool closed() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return closed_;
+  }
+  bool empty() const { return size() == 0; }
+  size_type size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return size_;
+  }
+  size_type capacity() const noexcept { return capacity_; }
+
+ private:
+  value_type *slot(size_type pos) const noexcept {
+    const size_type index = head_ + pos;
+    return data_ + (index < capacity_ ? index : index - capacity_);
+  }
+
+  bool full() const noexcept { return size_ == capacity_; }
+
+  // Ждущие на одной condition_variable. signalled — сколько из них уже
+  // разбужено, но ещё не взяло мьютекс: повторно их не будим.
+  struct Waiters {
+    void notify(size_type count) {
+      while (count-- > 0 && waiting > signalled) {
+        ++signalled;
+        condition.notify_one();
+      }
+    }
+    void notifyAll() {
+      signalled = waiting;
+      condition.notify_all();
+    }
+    void woken() noexcept {
+      --waiting;
+      if (signalled > 0) --signalled;
+    }
+
+    std::condition_variable condition;
+    size_type waiting = 0;
+    size_type signalled = 0;
+  };
+
+  // Ждёт, пока blocked() не станет ложным или очередь не закроют.
+  template <class Blocked>
+  void waitWhile(std::unique_lock<std::mutex> &lock, Waiters &waiters,
+                 Blocked blocked) {
+    while (blocked() && !closed_) {
+      ++waiters.waiting;
+      waiters.condition.wait(lock);
+      waiters.woken();
+    }
+  }
+
+  template <class Blocked, class Clock, class Duration>
+  void waitUntil(std::unique_lock<std::mutex> &lock, Waiters &waiters,
+                 Blocked blocked,
+                 const std::chrono::time_point<Clock, Duration> &deadline) {
+    while (blocked() && !closed_) {
+      ++waiters.waiting;
+      const std::cv_status status =
+          waiters.condition.wait_until(lock, deadline);
+      waiters.woken();
+      if (status == std::cv_status::timeout) break;
+    }
+  }
+
+  template <typename Value, class Clock, class Duration>
+  bool pushUntil(Value &&value,
+                 const std::chrono::time_point<Clock, Duration> &deadline) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    waitUntil(lock, producers_, [this] { return full(); }, deadline);
+    if (full()) return false;
+    return put(std::forward<Value>(value));
+  }
+
+  // Вызываются под мьютексом.
+  template <typename... Args>
+  bool put(Args &&...args) {
+    if (closed_) return false;
+    new (slot(size_)) value_type(std::forward<Args>(args)...);
+    ++size_;
+    consumers_.notify(1);
+    return true;
+  }
+
+  bool take(reference out) {
+    if (size_ == 0) return false;
+    value_type *item = slot(0);
+    out = std::move(*item);
+    item->~value_type();
+    head_ = head_ + 1 == capacity_ ? 0 : head_ + 1;
+    --size_;
+    producers_.notify(1);
+    return true;
+  }
+
+  size_type takeAll(Vector<value_type> &out) {
+    const size_type count = size_;
+    out.reserve(out.size() + count);
+    for (size_type i = 0; i < count; ++i) {
+      value_type *item = slot(0);
+      out.push_back(std::move(*item));
+      item->~value_type();
+      head_ = head_ + 1 == capacity_ ? 0 : head_ + 1;
+      --size_;
+    }
+    producers_.notify(count);
+    return count;
+  }
+
+  const size_type capacity_;
+  value_type *const data_;
+  size_type head_ = 0;
+  size_type size_ = 0;
+  bool closed_ = false;
+  mutable std::mutex mutex_;
+  Waiters producers_;
+  Waiters consumers_;
+};
+}  // namespace s21
+
+#endif  // CONTAINERS_SRC_S21_BLOCKING_QUEUE_H_
@@ -0,0 +1,273 @@
+#ifndef CONTAINERS_SRC_S21_CHANNEL_H_
+#define CONTAINERS_SRC_S21_CHANNEL_H_
+
+// Канал построен на сопрограммах C++20. Остальная библиотека собирается как
+// C++17, поэтому без поддержки сопрограмм заголовок пуст.
+#if defined(__cpp_impl_coroutine) && __has_include(<coroutine>)
+
+#include <coroutine>  // coroutine_handle suspend_always suspend_never
+#include <cstddef>    // size_t
+#include <exception>  // terminate
+#include <memory>     // allocator
+#include <new>        // placement new
+#include <optional>   // optional
+#include <utility>    // exchange move
+
+#include "s21_queue.h"
+
+namespace s21 {
+// Однопоточный исполнитель: очередь готовых к продолжению сопрограмм,
+// которую run() выполняет, пока та не опустеет. Достаточен для тестов и
+// для сервиса, где все сопрограммы живут в одном потоке событий.
+class manual_executor {
+ public:
+  using size_type = std::size_t;
+
+  void post(std::coroutine_handle<> handle) { ready_.push(handle); }
+
+  // Возвращает число продолженных сопрограмм.
+  size_type run() {
+    size_type resumed = 0;
+    while (!ready_.empty()) {
+      std::coroutine_handle<> handle = ready_.front();
+      ready_.pop();
+      handle.resume();
+      ++resumed;
+    }
+    return resumed;
+  }
+
+ private:
+  queue<std::coroutine_handle<>> ready_;
+};
+
+// Сопрограмма без результата, которая запускается через исполнитель и
+// сама освобождает свой кадр по завершении.
+class detached_task {
+ public:
+  struct promise_type {
+    detached_task get_return_object() noexcept {
+      return detached_task(
+          std::coroutine_handle<promise_type>::from_promise(*this));
+    }
+    std::suspend_always initial_suspend() noexcept { return {}; }
+    std::suspend_never final_suspend() noexcept { return {}; }
+    void return_void() noexcept {}
+    void unhandled_exception() noexcept { std::terminate(); }
+  };
+
+  detached_task(detached_task &&other) noexcept
+      : handle_(std::exchange(other.handle_, nullptr)) {}
+  detached_task(const detached_task &) = delete;
+  detached_task &operator=(const detached_task &) = delete;
+  detached_task &operator=(detached_task &&) = delete;
+  ~detached_task() {
+    if (handle_) handle_.destroy();
+  }
+
+  // Ставит сопрограмму в очередь исполнителя; дальше она живёт сама.
+  template <class Executor>
+  void start(Executor &executor) && {
+    executor.post(std::exchange(handle_, nullptr));
+  }
+
+ private:
+  explicit detached_task(std::coroutine_handle<promise_type> handle) noexcept
+      : handle_(handle) {}
+
+  std::coroutine_handle<promise_type> handle_;
+};
+
+// Ограниченный канал между сопрограммами: co_await ch.push(v) и
+// co_await ch.pop() приостанавливают сопрограмму, а не поток, когда канал
+// полон или пуст. Элементы лежат в собственном кольцевом буфере. Ожидающие
+// стоят в очередях FIFO прямо в своих кадрах (awaiter — узел списка), а
+// продолжаются через исполнитель, а не внутри чужого push или pop.
+//
+// Канал ёмкостью 0 — рандеву: push ждёт, пока его значение не заберут.
+// После close() ожидающие push получают false, pop — пустой optional,
+// когда элементы кончатся.
+//
+// Канал и все его сопрограммы должны работать в одном потоке исполнителя.
+// Ждущие в канале сопрограммы не освобождаются сами: перед разрушением
+// канал закрывают и дают исполнителю доработать.
+template <class T, class Executor = manual_executor>
+class channel {
+ public:
+  using value_type = T;
+  using size_type = std::size_t;
+
+  class push_awaiter;
+  class pop_awaiter;
+
+  channel(size_type capacity, Executor &executor)
+      : capacity_(capacity),
+        data_(capacity ? std::allocator<value_type>().allocate(capacity)
+                       : nullptr),
+        executor_(executor) {}
+
+  channel(const channel &) = delete;
+  channel &operator=(const channel &) = delete;
+
+  ~channel() {
+    for (size_type i = 0; i < size_; ++i) slot(i)->~value_type();
+    if (data_) std::allocator<value_type>().deallocate(data_, capacity_);
+  }
+
+  push_awaiter push(value_type value) {
+    return push_awaiter(*this, std::move(value));
+  }
+  pop_awaiter pop() { return pop_awaiter(*this); }
+
+  void close() {
+    closed_ = true;
+    while (pop_awaiter *consumer = consumers_.take())
+      executor_.post(consumer->handle_);
+    while (push_awaiter *producer = producers_.take()) {
+      producer->accepted_ = false;
+      executor_.post(producer->handle_);
+    }
+  }
+
+  bool closed() const noexcept { return closed_; }
+  bool empty() const noexcept { return size_ == 0; }
+  size_type size() const noexcept { return size_; }
+  size_type capacity() const noexcept { return capacity_; }
+
+  class push_awaiter {
+   public:
+    bool await_ready() {
+      if (channel_.closed_) return true;
+      if (pop_awaiter *consumer = channel_.consumers_.take()) {
+        consumer->result_.emplace(std::move(value_));
+        channel_.executor_.post(consumer->handle_);
+      } else if (channel_.size_ < channel_.capacity_) {
+        channel_.put(std::move(value_));
+      } else {
+        return false;
+      }
+      accepted_ = true;
+      return true;
+    }
+    void await_suspend(std::coroutine_handle<> handle) noexcept {
+      handle_ = handle;
+      channel_.producers_.add(this);
+    }
+    // false — канал закрыт, значение не передано.
+    bool await_resume() const noexcept { return accepted_; }
+
+   private:
+    friend class channel;
+
+    push_awaiter(channel &owner, value_type &&value)
+        : channel_(owner), value_(std::move(value)) {}
+
+    channel &channel_;
+    value_type value_;
+    bool accepted_ = false;
+    std::coroutine_handle<> handle_;
+    push_awaiter *next_ = nullptr;
+  };
+
+  class pop_awaiter {
+   public:
+    bool await_ready() {
+      if (channel_.size_ > 0) {
+        result_.emplace(channel_.take());
+        // Освободилось место: первый ждущий push кладёт своё значение.
+        if (push_awaiter *producer = channel_.producers_.take()) {
+          channel_.put(std::move(producer->value_));
+          channel_.accept(producer);
+        }
+        return true;
+      }
+      if (push_awaiter *producer = channel_.producers_.take()) {
+        result_.emplace(std::move(producer->value_));
+        channel_.accept(producer);
+        return true;
+      }
+      return channel_.closed_;
+    }
+    void await_suspend(std::coroutine_handle<> handle) noexcept {
+      handle_ = handle;
+      channel_.consumers_.add(this);
+    }
+    // Пустой optional — канал закрыт и опустел.
+    std::optional<value_type> await_resume() { return std::move(result_); }
+
+   private:
+    friend class channel;
+
+    explicit pop_awaiter(channel &owner) : channel_(owner) {}
+
+    channel &channel_;
+    std::optional<value_type> result_;
+    std::coroutine_handle<> handle_;
+    pop_awaiter *next_ = nullptr;
+  };
+
+ private:
+  // Очередь ожидающих, связанных через их собственное поле next_.
+  template <class Awaiter>
+  class WaitList {
+   public:
+    void add(Awaiter *awaiter) noexcept {
+      awaiter->next_ = nullptr;
+      if (tail_)
+        tail_->next_ = awaiter;
+      else
+        head_ = awaiter;
+      tail_ = awaiter;
+    }
+    Awaiter *take() noexcept {
+      Awaiter *awaiter = head_;
+      if (awaiter) {
+        head_ = awaiter->next_;
+        if (!head_) tail_ = nullptr;
+      }
+      return awaiter;
+    }
+
+   private:
+    Awaiter *head_ = nullptr;
+    Awaiter *tail_ = nullptr;
+  };
+
+  value_type *slot(size_type pos) const noexcept {
+    const size_type index = head_ + pos;
+    return data_ + (index < capacity_ ? index : index - capacity_);
+  }
+
+  void put(value_type &&value) {
+    new (slot(size_)) value_type(std::move(value));
+    ++size_;
+  }
+
+  value_type take() {
+    value_type *item = slot(0);
+    value_type value(std::move(*item));
+    item->~value_type();
+    head_ = head_ + 1 == capacity_ ? 0 : head_ + 1;
+    --size_;
+    return value;
+  }
+
+  void accept(push_awaiter *producer) {
+    producer->accepted_ = true;
+    executor_.post(producer->handle_);
+  }
+
+  const size_type capacity_;
+  value_type *const data_;
+  size_type head_ = 0;
+  size_type size_ = 0;
+  bool closed_ = false;
+  Executor &executor_;
+  WaitList<push_awaiter> producers_;
+  WaitList<pop_awaiter> consumers_;
+};
+}  // namespace s21
+
+#endif  // __cpp_impl_coroutine
+
+#endif  // CONTAINERS_SRC_S21_CHANNEL_H_
@@ -0,0 +1,302 @@
+#ifndef CONTAINERS_SRC_S21_CONCURRENT_STACK_H_
+#define CONTAINERS_SRC_S21_CONCURRENT_STACK_H_
+
+#include <atomic>       // atomic memory_order
+#include <cstddef>      // size_t
+#include <cstdint>      // uint32_t uint64_t uintptr_t
+#include <functional>   // hash
+#include <thread>       // this_thread
+#include <type_traits>  // is_nothrow_move_assignable_v
+#include <utility>      // forward move
+
+#include "s21_spin_wait.h"
+
+namespace s21 {
+// Неблокирующий стек Трайбера: односвязный список с вершиной head_,
+// которую push и pop меняют CAS.
+//
+// ABA. Рядом с указателем в том же 64-битном слове хранится счётчик
+// изменений (тег), и CAS сравнивает оба. Указатель занимает младшие 48 бит
+// (на 32-битных платформах — 32), тег — остальные.
+//
+// Освобождение памяти — указатели опасности (hazard pointers). Перед чтением
+// next у вершины pop объявляет её в своей записи опасности. Снятые узлы
+// копятся в списке retired_ и удаляются пачкой, когда их не объявил ни один
+// поток.
+//
+// Под нагрузкой после неудачного CAS поток идёт в массив исключения:
+// push выставляет узел в случайную ячейку и немного ждёт, pop забирает его
+// оттуда. Такая пара не трогает head_ вовсе.
+template <class T>
+class concurrent_stack {
+ public:
+  using value_type = T;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using size_type = std::size_t;
+
+  static constexpr size_type kEliminationSlots = 16;
+  static constexpr unsigned kEliminationSpins = 64;
+  static constexpr size_type kRetireBatch = 64;
+
+  concurrent_stack() = default;
+  concurrent_stack(const concurrent_stack &) = delete;
+  concurrent_stack &operator=(const concurrent_stack &) = delete;
+
+  ~concurrent_stack() {
+    deleteChain(pointer(head_.load(std::memory_order_relaxed)));
+    deleteChain(retired_.load(std::memory_order_relaxed));
+    HazardRecord *record = hazards_.load(std::memory_order_relaxed);
+    while (record) {
+      HazardRecord *next = record->next;
+      delete record;
+      record = next;
+    }
+  }
+
+  void push(const_reference value) { emplace(value); }
+  void push(value_type &&value) { emplace(std::move(value)); }
+
+  template <typename... Args>
+  void emplace(Args &&...args) {
+    Node *node = new Node(std::forward<Args>(args)...);
+    std::uint64_t top = head_.load(std::memory_order_relaxed);
+    for (;;) {
+      node->next.store(pointer(top), std::memory_order_relaxed);
+      if (head_.compare_exchange_weak(top, pack(node, tag(top) + 1),
+                                      std::memory_order_release,
+                                      std::memory_order_relaxed))
+        return;
+      if (offer(node)) return;
+      top = head_.load(std::memory_order_relaxed);
+    }
+  }
+
+  bool try_pop(reference out) {
+    HazardRecord *hazard = acquireHazard();
+    Node *node = nullptr;
+    std::uint64_t top = head_.load(std::memory_order_acquire);
+    for (;;) {
+      node = pointer(top);
+      if (!node) break;
+      hazard->pointer.store(node);
+      const std::uint64_t current = head_.load();
+      if (current != top) {
+        top = current;
+        continue;
+      }
+      // Узел объявлен и ещё на вершине: до удаления дело не дойдёт.
+      Node *next = node->next.load(std::memory_order_relaxed);
+      if (head_.compare_exchange_weak(top, pack(next, tag(top) + 1))) break;
+      if (Node *taken = take()) {
+        hazard->pointer.store(nullptr, std::memory_order_release);
+        hazard->active.store(false, std::memory_order_release);
+        return extract(taken, out, false);
+      }
+      top = head_.load(std::memory_order_acquire);
+    }
+    hazard->pointer.store(nullptr, std::memory_order_release);
+    hazard->active.store(false, std::memory_order_release);
+    return node ? extract(node, out, true) : false;
+  }
+
+  // Ждёт элемента.
+  void pop(reference out) {
+    spin_wait waiter;
+    while (!try_pop(out)) waiter.wait();
+  }
+
+  // Под нагрузкой значение приблизительное.
+  bool empty() const noexcept {
+    return pointer(head_.load(std::memory_order_acquire)) == nullptr;
+  }
+
+ private:
+  struct Node {
+    template <typename... Args>
+    explicit Node(Args &&...args) : value(std::forward<Args>(args)...) {}
+
+    value_type value;
+    std::atomic<Node *> next{nullptr};
+  };
+
+  struct alignas(kCacheLineSize) HazardRecord {
+    std::atomic<Node *> pointer{nullptr};
+    std::atomic<bool> active{true};
+    HazardRecord *next = nullptr;
+  };
+
+  static constexpr unsigned kPointerBits = sizeof(void *) == 8 ? 48 : 32;
+  static constexpr std::uint64_t kPointerMask =
+      (std::uint64_t{1} << kPointerBits) - 1;
+
+  static std::uint64_t pack(Node *node, std::uint64_t tag) noexcept {
+    return (tag << kPointerBits) |
+           static_cast<std::uint64_t>(reinterpret_cast<std::uintptr_t>(node));
+  }
+  static Node *pointer(std::uint64_t word) noexcept {
+    return reinterpret_cast<Node *>(
+        static_cast<std::uintptr_t>(word & kPointerMask));
+  }
+  static std::uint64_t tag(std::uint64_t word) noexcept {
+    return word >> kPointerBits;
+  }
+
+  static void deleteChain(Node *node) noexcept {
+    while (node) {
+      Node *next = node->next.load(std::memory_order_relaxed);
+      delete node;
+      node = next;
+    }
+  }
+
+  // Забирает значение из узла, которым поток теперь владеет один. Узел из
+  // стека мог быть объявлен другими потоками, поэтому он уходит в retired_;
+  // узел из массива исключения в стеке не был и удаляется сразу.
+  bool extract(Node *node, reference out, bool shared) {
+    if constexpr (std::is_nothrow_move_assignable_v<value_type>) {
+      out = std::move(node->value);
+    } else {
+      try {
+        out = std::move(node->value);
+      } catch (...) {
+        dispose(node, shared);
+        throw;
+      }
+    }
+    dispose(node, shared);
+    return true;
+  }
+
+  void dispose(Node *node, bool shared) noexcept {
+    if (shared)
+      retire(node);
+    else
+      delete node;
+  }
+
+  // Ячейки массива исключения — такие же пары указатель и тег, как head_.
+  static size_type randomSlot() noexcept {
+    thread_local std::uint32_t state = static_cast<std::uint32_t>(
+        std::hash<std::thread::id>()(std::this_thread::get_id()) | 1);
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return state % kEliminationSlots;
+  }
+
+  // Выставляет узел в ячейку и ждёт pop. false — узел не забрали и он
+  // снова принадлежит вызывающему.
+  bool offer(Node *node) noexcept {
+    std::atomic<std::uint64_t> &slot = elimination_[randomSlot()].word;
+    std::uint64_t word = slot.load(std::memory_order_relaxed);
+    if (pointer(word)) return false;
+    const std::uint64_t offered = pack(node, tag(word) + 1);
+    if (!slot.compare_exchange_strong(word, offered,
+                                      std::memory_order_release,
+                                      std::memory_order_relaxed))
+      return false;
+    for (unsigned i = 0; i < kEliminationSpins; ++i) {
+      if (slot.load(std::memory_order_relaxed) != offered) return true;
+      spin_wait::relax();
+    }
+    std::uint64_t expected = offered;
+    return !slot.compare_exchange_strong(expected,
+                                         pack(nullptr, tag(offered) + 1),
+                                         std::memory_order_relaxed);
+  }
+
+  Node *take() noexcept {
+    std::atomic<std::uint64_t> &slot = elimination_[randomSlot()].word;
+    std::uint64_t word = slot.load(std::memory_order_relaxed);
+    Node *node = pointer(word);
+    if (node && slot.compare_exchange_strong(word, pack(nullptr, tag(word) + 1),
+                                             std::memory_order_acquire,
+                                             std::memory_order_relaxed))
+      return node;
+    return nullptr;
+  }
+
+  // Записи опасности не удаляются до конца жизни стека: свободную запись
+  // поток занимает флагом active, новая добавляется в голову hazards_.
+  HazardRecord *acquireHazard() {
+    for (HazardRecord *record = hazards_.load(std::memory_order_acquire);
+         record; record = record->next) {
+      bool expected = false;
+      if (!record->active.load(std::memory_order_relaxed) &&
+          record->active.compare_exchange_strong(expected, true,
+                                                 std::memory_order_acquire))
+        return record;
+    }
+    HazardRecord *record = new HazardRecord;
+    record->next = hazards_.load(std::memory_order_relaxed);
+    while (!hazards_.compare_exchange_weak(record->next, record,
+                                           std::memory_order_release,
+                                           std::memory_order_relaxed)) {
+    }
+    hazard_count_.fetch_add(1, std::memory_order_relaxed);
+    return record;
+  }
+
+  bool isHazard(Node *node) const noexcept {
+    for (HazardRecord *record = hazards_.load(std::memory_order_acquire);
+         record; record = record->next)
+      if (record->pointer.load() == node) return true;
+    return false;
+  }
+
+  // Снятый узел уходит в retired_ через поле next: устаревшее next может
+  // прочитать только поток, чей CAS после этого не пройдёт по тегу.
+  void retire(Node *node) noexcept {
+    const size_type threshold =
+        2 * hazard_count_.load(std::memory_order_relaxed) + kRetireBatch;
+    const size_type count =
+        retired_count_.fetch_add(1, std::memory_order_relaxed) + 1;
+    pushRetired(node, node);
+    if (count >= threshold) reclaim();
+  }
+
+  void pushRetired(Node *first, Node *last) noexcept {
+    Node *head = retired_.load(std::memory_order_relaxed);
+    do {
+      last->next.store(head, std::memory_order_relaxed);
+    } while (!retired_.compare_exchange_weak(head, first,
+                                             std::memory_order_release,
+                                             std::memory_order_relaxed));
+  }
+
+  void reclaim() noexcept {
+    Node *node = retired_.exchange(nullptr, std::memory_order_acquire);
+    Node *kept_first = nullptr, *kept_last = nullptr;
+    size_type taken = 0, kept = 0;
+    while (node) {
+      Node *next = node->next.load(std::memory_order_relaxed);
+      ++taken;
+      if (isHazard(node)) {
+        node->next.store(kept_first, std::memory_order_relaxed);
+        if (!kept_first) kept_last = node;
+        kept_first = node;
+        ++kept;
+      } else {
+        delete node;
+      }
+      node = next;
+    }
+    retired_count_.fetch_sub(taken - kept, std::memory_order_relaxed);
+    if (kept_first) pushRetired(kept_first, kept_last);
+  }
+
+  struct alignas(kCacheLineSize) EliminationSlot {
+    std::atomic<std::uint64_t> word{0};
+  };
+
+  alignas(kCacheLineSize) std::atomic<std::uint64_t> head_{0};
+  alignas(kCacheLineSize) std::atomic<Node *> retired_{nullptr};
+  std::atomic<size_type> retired_count_{0};
+  std::atomic<HazardRecord *> hazards_{nullptr};
+  std::atomic<size_type> hazard_count_{0};
+  EliminationSlot elimination_[kEliminationSlots];
+};
+}  // namespace s21
+
+#endif  // CONTAINERS_SRC_S21_CONCURRENT_STACK_H_
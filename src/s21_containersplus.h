@@ -1,7 +1,24 @@
 #ifndef CONTAINERS_SRC_S21_CONTAINERSLUS_H_
 #define CONTAINERS_SRC_S21_CONTAINERSLUS_H_
 
-// #include "s21_array.h"
+#include "s21_array.h"
+#include "s21_blocking_queue.h"
+#include "s21_channel.h"
+#include "s21_concurrent_stack.h"
+#include "s21_deque.h"
+#include "s21_forward_list.h"
+#include "s21_intrusive_list.h"
+#include "s21_list_parallel_sort.h"
+#include "s21_lru_cache.h"
+#include "s21_mpmc_queue.h"
+#include "s21_multilevel_queue.h"
 #include "s21_multiset.h"
+#include "s21_ring_buffer.h"
+#include "s21_spill_queue.h"
+#include "s21_spsc_queue.h"
+#include "s21_static_vector.h"
+#include "s21_thread_pool.h"
+#include "s21_unrolled_list.h"
+#include "s21_work_stealing_deque.h"
 
 #endif  // CONTAINERS_SRC_S21_CONTAINERSLUS_H_
@@ -0,0 +1,409 @@
+#ifndef CONTAINERS_SRC_S21_DEQUE_H_
+#define CONTAINERS_SRC_S21_DEQUE_H_
+
+#include <algorithm>         // copy copy_backward fill max
+#include <cstddef>           // size_t ptrdiff_t
+#include <initializer_list>  // initializer_list
+#include <iterator>          // random_access_iterator_tag
+#include <limits>            // max
+#include <memory>            // allocator
+#include <new>               // placement new
+#include <stdexcept>         // out_of_range
+#include <type_traits>       // enable_if is_const
+#include <utility>           // forward move swap
+
+namespace s21 {
+// По умолчанию блок занимает около 512 байт, но не меньше 16 элементов.
+template <class T>
+constexpr std::size_t kDequeBlockSize =
+    512 / sizeof(T) > 16 ? 512 / sizeof(T) : 16;
+
+// Двусторонняя очередь из блоков по kBlockSize элементов. Указатели на блоки
+// лежат подряд в карте map_, занятый участок карты — [first_block_,
+// first_block_ + blocks_), первый элемент — start_ в первом блоке. Вставка и
+// удаление на концах работают за O(1) и не перемещают элементы, поэтому
+// ссылки на элементы остаются действительными; при росте перекладывается
+// только карта. Итераторы при вставке становятся недействительными.
+//
+// За картой всегда есть свободная ячейка с nullptr: end() на границе блока
+// указывает на неё.
+template <class T>
+class deque {
+  template <typename Value>
+  class DequeIterator;
+
+ public:
+  using value_type = T;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using iterator = DequeIterator<value_type>;
+  using const_iterator = DequeIterator<const value_type>;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+
+  static constexpr size_type kBlockSize = kDequeBlockSize<T>;
+
+  deque() noexcept
+      : map_(nullptr),
+        map_capacity_(0),
+        first_block_(0),
+        blocks_(0),
+        start_(0),
+        size_(0),
+        spare_(nullptr) {}
+  explicit deque(size_type n) : deque() {
+    for (; n > 0; --n) emplace_back();
+  }
+  deque(std::initializer_list<value_type> const &items) : deque() {
+    for (const_reference item : items) push_back(item);
+  }
+  deque(const deque &other) : deque() {
+    for (const_reference item : other) push_back(item);
+  }
+  deque(deque &&other) noexcept : deque() { swap(other); }
+  ~deque() {
+    clear();
+    shrink_to_fit();
+    delete[] map_;
+  }
+
+  deque &operator=(const deque &other) {
+    if (this != &other) {
+      deque tmp(other);
+      swap(tmp);
+    }
+    return *this;
+  }
+  deque &operator=(deque &&other) noexcept {
+    if (this != &other) {
+      deque tmp(std::move(other));
+      swap(tmp);
+    }
+    return *this;
+  }
+
+  reference at(size_type pos) {
+    checkIndex(pos);
+    return (*this)[pos];
+  }
+  const_reference at(size_type pos) const {
+    checkIndex(pos);
+    return (*this)[pos];
+  }
+  reference operator[](size_type pos) noexcept { return *slot(start_ + pos); }
+  const_reference operator[](size_type pos) const noexcept {
+    return *slot(start_ + pos);
+  }
+  reference front() noexcept { return *slot(start_); }
+  const_reference front() const noexcept { return *slot(start_); }
+  reference back() noexcept { return *slot(start_ + size_ - 1); }
+  const_reference back() const noexcept { return *slot(start_ + size_ - 1); }
+
+  iterator begin() noexcept { return iterator(map_, first_block_, start_); }
+  iterator end() noexcept {
+    return iterator(map_, first_block_, start_ + size_);
+  }
+  const_iterator begin() const noexcept {
+    return const_iterator(map_, first_block_, start_);
+  }
+  const_iterator end() const noexcept {
+    return const_iterator(map_, first_block_, start_ + size_);
+  }
+  const_iterator cbegin() const noexcept { return begin(); }
+  const_iterator cend() const noexcept { return end(); }
+
+  bool empty() const noexcept { return size_ == 0; }
+  size_type size() const noexcept { return size_; }
+  size_type max_size() const noexcept {
+    return std::numeric_limits<difference_type>::max() / sizeof(value_type);
+  }
+
+  void push_back(const_reference value) { emplace_back(value); }
+  void push_back(value_type &&value) { emplace_back(std::move(value)); }
+  void push_front(const_reference value) { emplace_front(value); }
+  void push_front(value_type &&value) { emplace_front(std::move(value)); }
+
+  template <typename... Args>
+  reference emplace_back(Args &&...args) {
+    const size_type index = start_ + size_;
+    if (index == blocks_ * kBlockSize) addBlockBack();
+    value_type *place = slot(index);
+    // При исключении лишний блок останется в карте и достанется следующей
+    // вставке или будет возвращён при удалении.
+    new (place) value_type(std::forward<Args>(args)...);
+    ++size_;
+    return *place;
+  }
+
+  template <typename... Args>
+  reference emplace_front(Args &&...args) {
+    if (start_ == 0) addBlockFront();
+    value_type *place = slot(start_ - 1);
+    try {
+      new (place) value_type(std::forward<Args>(args)...);
+    } catch (...) {
+      trimFront();
+      throw;
+    }
+    --start_;
+    ++size_;
+    return *place;
+  }
+
+  // Как и у S21::List, удаление из пустой очереди ничего не делает.
+  void pop_back() noexcept {
+    if (size_ == 0) return;
+    back().~value_type();
+    --size_;
+    if (size_ == 0 || (start_ + size_) % kBlockSize == 0) trimBack();
+  }
+  void pop_front() noexcept {
+    if (size_ == 0) return;
+    front().~value_type();
+    ++start_;
+    --size_;
+    trimFront();
+  }
+
+  void clear() noexcept {
+    for (size_type i = 0; i < size_; ++i) slot(start_ + i)->~value_type();
+    size_ = 0;
+    trimBack();
+  }
+
+  // Отдаёт запасной блок, который держится против перевыделений на границе.
+  void shrink_to_fit() noexcept {
+    deallocateBlock(spare_);
+    spare_ = nullptr;
+  }
+
+  void swap(deque &other) noexcept {
+    std::swap(map_, other.map_);
+    std::swap(map_capacity_, other.map_capacity_);
+    std::swap(first_block_, other.first_block_);
+    std::swap(blocks_, other.blocks_);
+    std::swap(start_, other.start_);
+    std::swap(size_, other.size_);
+    std::swap(spare_, other.spare_);
+  }
+
+ private:
+  template <typename Value>
+  class DequeIterator {
+   public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = std::remove_const_t<Value>;
+    using difference_type = std::ptrdiff_t;
+    using pointer = Value *;
+    using reference = Value &;
+
+    DequeIterator() noexcept : cur_(nullptr), first_(nullptr), node_(nullptr) {}
+
+    // iterator приводится к const_iterator.
+    template <typename Other,
+              typename = std::enable_if_t<std::is_const_v<Value> &&
+                                          !std::is_const_v<Other>>>
+    DequeIterator(const DequeIterator<Other> &other) noexcept
+        : cur_(other.cur_), first_(other.first_), node_(other.node_) {}
+
+    reference operator*() const { return *cur_; }
+    pointer operator->() const { return cur_; }
+    reference operator[](difference_type n) const { return *(*this + n); }
+
+    DequeIterator &operator++() {
+      if (++cur_ == first_ + kBlockSize) {
+        setNode(node_ + 1);
+        cur_ = first_;
+      }
+      return *this;
+    }
+    DequeIterator &operator--() {
+      if (cur_ == first_) {
+        setNode(node_ - 1);
+        cur_ = first_ + kBlockSize;
+      }
+      --cur_;
+      return *this;
+    }
+    DequeIterator operator++(int) {
+      DequeIterator temp = *this;
+      ++*this;
+      return temp;
+    }
+    DequeIterator operator--(int) {
+      DequeIterator temp = *this;
+      --*this;
+      return temp;
+    }
+
+    DequeIterator &operator+=(difference_type n) {
+      const difference_type block = static_cast<difference_type>(kBlockSize);
+      const difference_type offset = (cur_ - first_) + n;
+      if (offset >= 0 && offset < block) {
+        cur_ += n;
+      } else {
+        const difference_type node_offset =
+            offset > 0 ? offset / block : -((-offset - 1) / block) - 1;
+        setNode(node_ + node_offset);
+        cur_ = first_ + (offset - node_offset * block);
+      }
+      return *this;
+    }
+    DequeIterator &operator-=(difference_type n) { return *this += -n; }
+    DequeIterator operator+(difference_type n) const {
+      DequeIterator temp = *this;
+      return temp += n;
+    }
+    DequeIterator operator-(difference_type n) const {
+      DequeIterator temp = *this;
+      return temp -= n;
+    }
+    friend DequeIterator operator+(difference_type n, const DequeIterator &it) {
+      return it + n;
+    }
+    difference_type operator-(const DequeIterator &other) const {
+      return (node_ - other.node_) * static_cast<difference_type>(kBlockSize) +
+             (cur_ - first_) - (other.cur_ - other.first_);
+    }
+
+    bool operator==(const DequeIterator &other) const {
+      return cur_ == other.cur_;
+    }
+    bool operator!=(const DequeIterator &other) const {
+      return cur_ != other.cur_;
+    }
+    bool operator<(const DequeIterator &other) const {
+      return *this - other < 0;
+    }
+    bool operator>(const DequeIterator &other) const { return other < *this; }
+    bool operator<=(const DequeIterator &other) const {
+      return !(other < *this);
+    }
+    bool operator>=(const DequeIterator &other) const {
+      return !(*this < other);
+    }
+
+   private:
+    friend class deque;
+    template <typename>
+    friend class DequeIterator;
+
+    // Позиция index считается от начала первого занятого блока.
+    DequeIterator(value_type **map, size_type first_block, size_type index)
+        : DequeIterator() {
+      if (!map) return;
+      setNode(map + first_block + index / kBlockSize);
+      cur_ = first_ + index % kBlockSize;
+    }
+
+    void setNode(value_type **node) noexcept {
+      node_ = node;
+      first_ = *node;
+    }
+
+    pointer cur_;
+    pointer first_;
+    value_type **node_;
+  };
+
+  value_type *slot(size_type index) const noexcept {
+    return map_[first_block_ + index / kBlockSize] + index % kBlockSize;
+  }
+
+  void checkIndex(size_type pos) const {
+    if (pos >= size_) throw std::out_of_range("deque index out of range");
+  }
+
+  value_type *allocateBlock() {
+    if (spare_) return std::exchange(spare_, nullptr);
+    return std::allocator<value_type>().allocate(kBlockSize);
+  }
+  static void deallocateBlock(value_type *block) noexcept {
+    if (block) std::allocator<value_type>().deallocate(block, kBlockSize);
+  }
+  // Один освобождённый блок остаётся в запасе: push и pop на границе блока
+  // не обращаются к куче каждый раз.
+  void releaseBlock(value_type *block) noexcept {
+    if (spare_)
+      deallocateBlock(block);
+    else
+      spare_ = block;
+  }
+
+  void addBlockBack() {
+    if (first_block_ + blocks_ + 1 >= map_capacity_) reorganizeMap();
+    map_[first_block_ + blocks_] = allocateBlock();
+    ++blocks_;
+  }
+
+  void addBlockFront() {
+    if (first_block_ == 0 || first_block_ + blocks_ + 1 > map_capacity_)
+      reorganizeMap();
+    map_[first_block_ - 1] = allocateBlock();
+    --first_block_;
+    ++blocks_;
+    start_ = kBlockSize;
+  }
+
+  // Ставит занятый участок карты в середину, при нехватке места — в новую
+  // карту вдвое больше. Перекладываются только указатели на блоки.
+  void reorganizeMap() {
+    const size_type needed = blocks_ + 2;
+    value_type **map = map_;
+    size_type capacity = map_capacity_;
+    if (capacity < 2 * needed) {
+      capacity = std::max<size_type>(8, 2 * capacity);
+      while (capacity < 2 * needed) capacity *= 2;
+      map = new value_type *[capacity]();
+    }
+    const size_type first = (capacity - blocks_) / 2;
+    value_type **used = map_ + first_block_;
+    if (map != map_) {
+      std::copy(used, used + blocks_, map + first);
+      delete[] map_;
+    } else if (first < first_block_) {
+      std::copy(used, used + blocks_, map + first);
+    } else {
+      std::copy_backward(used, used + blocks_, map + first + blocks_);
+    }
+    std::fill(map, map + first, nullptr);
+    std::fill(map + first + blocks_, map + capacity, nullptr);
+    map_ = map;
+    map_capacity_ = capacity;
+    first_block_ = first;
+  }
+
+  // Возвращает блоки в конце, где не осталось элементов.
+  void trimBack() noexcept {
+    const size_type needed =
+        size_ ? (start_ + size_ - 1) / kBlockSize + 1 : 0;
+    while (blocks_ > needed) {
+      --blocks_;
+      releaseBlock(std::exchange(map_[first_block_ + blocks_], nullptr));
+    }
+    if (blocks_ == 0) start_ = 0;
+  }
+
+  // Возвращает первый блок, если он опустел.
+  void trimFront() noexcept {
+    if (size_ == 0) {
+      trimBack();
+    } else if (start_ == kBlockSize) {
+      releaseBlock(std::exchange(map_[first_block_], nullptr));
+      ++first_block_;
+      --blocks_;
+      start_ = 0;
+    }
+  }
+
+  value_type **map_;
+  size_type map_capacity_;
+  size_type first_block_;
+  size_type blocks_;
+  size_type start_;
+  size_type size_;
+  value_type *spare_;
+};
+}  // namespace s21
+
+#endif  // CONTAINERS_SRC_S21_DEQUE_H_
@@ -0,0 +1,423 @@
+#ifndef CONTAINERS_SRC_S21_FORWARD_LIST_H_
+#define CONTAINERS_SRC_S21_FORWARD_LIST_H_
+
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <limits>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "s21_node_pool.h"
+namespace S21 {
+// Односвязный список. Голова хранится внутри объекта, узлы берутся из
+// NodePool. Список без переданного пула при первой вставке берёт пул
+// потока default_pool(): узлы всех таких списков потока лежат в общих
+// блоках, и короткая цепочка стоит столько же, сколько её узлы.
+// Списки с общим пулом нельзя менять из разных потоков. Список, получивший
+// узлы из пула одного потока, меняют только в этом потоке; список для
+// другого потока создают со своим пулом из make_pool().
+template <typename T>
+class forward_list {
+  struct ForwardNodeBase;
+  struct ForwardNode;
+  class ForwardIterator;
+  class ForwardConstIterator;
+
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using iterator = ForwardIterator;
+  using const_iterator = ForwardConstIterator;
+  using size_type = std::size_t;
+  using pool_type = NodePool<ForwardNode>;
+
+  static std::shared_ptr<pool_type> make_pool(
+      size_type first_slab_nodes = pool_type::kFirstSlabNodes) {
+    return std::make_shared<pool_type>(first_slab_nodes);
+  }
+
+  // Пул текущего потока. Его блоки освобождаются, когда поток завершён и
+  // уничтожены все списки из него; узлы очищенных списков переиспользуются.
+  // Пул, влитый через splice_after или merge в другой, заменяется новым.
+  static std::shared_ptr<pool_type> default_pool() {
+    thread_local std::shared_ptr<pool_type> pool;
+    std::shared_ptr<pool_type> resolved = pool;
+    pool_type::resolve(resolved);
+    if (!pool || resolved != pool) pool = make_pool();
+    return pool;
+  }
+
+  forward_list() noexcept : head_{nullptr} {}
+
+  explicit forward_list(std::shared_ptr<pool_type> pool) noexcept
+      : head_{nullptr}, pool_(std::move(pool)) {}
+
+  forward_list(size_type n) : forward_list() {
+    iterator last = before_begin();
+    for (; n > 0; --n) last = emplace_after(last);
+  }
+
+  forward_list(std::initializer_list<value_type> const &items)
+      : forward_list() {
+    iterator last = before_begin();
+    for (const_reference item : items) last = insert_after(last, item);
+  }
+
+  forward_list(const forward_list &l) : forward_list() {
+    iterator last = before_begin();
+    for (const_reference item : l) last = insert_after(last, item);
+  }
+
+  forward_list(forward_list &&l) noexcept : forward_list() { swap(l); }
+
+  ~forward_list() { clear(); }
+
+  forward_list &operator=(const forward_list &l) {
+    if (this != &l) {
+      forward_list tmp(l);
+      swap(tmp);
+    }
+    return *this;
+  }
+
+  forward_list &operator=(forward_list &&l) noexcept {
+    if (this != &l) {
+      forward_list tmp(std::move(l));
+      swap(tmp);
+    }
+    return *this;
+  }
+
+  reference front() { return valueOf(head_.next_); }
+  const_reference front() const { return valueOf(head_.next_); }
+
+  iterator before_begin() noexcept { return iterator(&head_); }
+  const_iterator before_begin() const noexcept {
+    return const_iterator(const_cast<ForwardNodeBase *>(&head_));
+  }
+  iterator begin() noexcept { return iterator(head_.next_); }
+  iterator end() noexcept { return iterator(nullptr); }
+  const_iterator begin() const noexcept { return const_iterator(head_.next_); }
+  const_iterator end() const noexcept { return const_iterator(nullptr); }
+
+  bool empty() const noexcept { return head_.next_ == nullptr; }
+  size_type max_size() const noexcept {
+    return std::numeric_limits<size_type>::max();
+  }
+
+  void clear() noexcept {
+    Pool::resolve(pool_);
+    // Как и в S21::List: если пул больше никто не использует, блоки
+    // освобождаются разом, а не по узлу.
+    const bool exclusive = pool_.use_count() == 1;
+    if (!exclusive || !std::is_trivially_destructible_v<T>) {
+      for (ForwardNodeBase *node = head_.next_; node;) {
+        ForwardNode *value_node = static_cast<ForwardNode *>(node);
+        node = node->next_;
+        value_node->~ForwardNode();
+        if (!exclusive) pool_->deallocate(value_node);
+      }
+    }
+    if (exclusive) pool_->release();
+    head_.next_ = nullptr;
+  }
+
+  iterator insert_after(const_iterator pos, const_reference value) {
+    return emplace_after(pos, value);
+  }
+
+  iterator insert_after(const_iterator pos, value_type &&value) {
+    return emplace_after(pos, std::move(value));
+  }
+
+  template <typename... Args>
+  iterator emplace_after(const_iterator pos, Args &&...args) {
+    ForwardNodeBase *node = createNode(std::forward<Args>(args)...);
+    node->next_ = pos.it->next_;
+    pos.it->next_ = node;
+    return iterator(node);
+  }
+
+  // Удаляет элемент, следующий за pos, и возвращает итератор на следующий.
+  iterator erase_after(const_iterator pos) {
+    ForwardNodeBase *node = pos.it->next_;
+    pos.it->next_ = node->next_;
+    destroyNode(node);
+    return iterator(pos.it->next_);
+  }
+
+  // Удаляет элементы в интервале (first, last).
+  iterator erase_after(const_iterator first, const_iterator last) {
+    while (first.it->next_ != last.it) erase_after(first);
+    return iterator(last.it);
+  }
+
+  void push_front(const_reference value) { emplace_front(value); }
+  void push_front(value_type &&value) { emplace_front(std::move(value)); }
+
+  template <typename... Args>
+  reference emplace_front(Args &&...args) {
+    return *emplace_after(before_begin(), std::forward<Args>(args)...);
+  }
+
+  void pop_front() {
+    if (head_.next_) erase_after(before_begin());
+  }
+
+  void swap(forward_list &l) noexcept {
+    std::swap(head_.next_, l.head_.next_);
+    std::swap(pool_, l.pool_);
+  }
+
+  // splice_after и merge только перецепляют узлы и объединяют пулы.
+  void splice_after(const_iterator pos, forward_list &l) {
+    if (this == &l || l.empty()) return;
+    Pool::join(pool_, l.pool_);
+    ForwardNodeBase *last = &l.head_;
+    while (last->next_) last = last->next_;
+    last->next_ = pos.it->next_;
+    pos.it->next_ = l.head_.next_;
+    l.head_.next_ = nullptr;
+  }
+
+  // Переносит элемент, следующий за it.
+  void splice_after(const_iterator pos, forward_list &l, const_iterator it) {
+    ForwardNodeBase *node = it.it->next_;
+    if (pos.it == it.it || pos.it == node) return;
+    if (this != &l) Pool::join(pool_, l.pool_);
+    it.it->next_ = node->next_;
+    node->next_ = pos.it->next_;
+    pos.it->next_ = node;
+  }
+
+  // Переносит элементы в интервале (first, last).
+  void splice_after(const_iterator pos, forward_list &l, const_iterator first,
+                    const_iterator last) {
+    if (first == last || first.it->next_ == last.it) return;
+    if (this != &l) Pool::join(pool_, l.pool_);
+    ForwardNodeBase *tail = first.it;
+    while (tail->next_ != last.it) tail = tail->next_;
+    tail->next_ = pos.it->next_;
+    pos.it->next_ = first.it->next_;
+    first.it->next_ = last.it;
+  }
+
+  void merge(forward_list &l) { merge(l, std::less<value_type>()); }
+
+  template <typename Compare>
+  void merge(forward_list &l, Compare comp) {
+    if (this == &l || l.empty()) return;
+    Pool::join(pool_, l.pool_);
+    head_.next_ = mergeChains(head_.next_, l.head_.next_, comp);
+    l.head_.next_ = nullptr;
+  }
+
+  void sort() { sort(std::less<value_type>()); }
+
+  // Та же устойчивая восходящая сортировка слиянием, что и в S21::List.
+  template <typename Compare>
+  void sort(Compare comp) {
+    if (!head_.next_ || !head_.next_->next_) return;
+    ForwardNodeBase *bins[std::numeric_limits<size_type>::digits] = {};
+    ForwardNodeBase *node = head_.next_;
+    while (node) {
+      ForwardNodeBase *carry = node;
+      node = node->next_;
+      carry->next_ = nullptr;
+      size_type i = 0;
+      for (; bins[i]; ++i) {
+        carry = mergeChains(bins[i], carry, comp);
+        bins[i] = nullptr;
+      }
+      bins[i] = carry;
+    }
+    ForwardNodeBase *result = nullptr;
+    for (ForwardNodeBase *bin : bins)
+      if (bin) result = result ? mergeChains(bin, result, comp) : bin;
+    head_.next_ = result;
+  }
+
+  void reverse() noexcept {
+    ForwardNodeBase *reversed = nullptr;
+    for (ForwardNodeBase *node = head_.next_; node;) {
+      ForwardNodeBase *next = node->next_;
+      node->next_ = reversed;
+      reversed = node;
+      node = next;
+    }
+    head_.next_ = reversed;
+  }
+
+  void unique() { unique(std::equal_to<value_type>()); }
+
+  template <typename BinaryPredicate>
+  void unique(BinaryPredicate pred) {
+    ForwardNodeBase *kept = head_.next_;
+    while (kept && kept->next_) {
+      if (pred(valueOf(kept), valueOf(kept->next_)))
+        erase_after(iterator(kept));
+      else
+        kept = kept->next_;
+    }
+  }
+
+  size_type remove(const_reference value) {
+    // value может лежать в самом списке: такой узел удаляется последним.
+    ForwardNodeBase *self_prev = nullptr;
+    size_type removed = 0;
+    for (ForwardNodeBase *prev = &head_; prev->next_;) {
+      if (&valueOf(prev->next_) == &value) {
+        self_prev = prev;
+        prev = prev->next_;
+      } else if (valueOf(prev->next_) == value) {
+        erase_after(iterator(prev));
+        ++removed;
+      } else {
+        prev = prev->next_;
+      }
+    }
+    if (self_prev) {
+      erase_after(iterator(self_prev));
+      ++removed;
+    }
+    return removed;
+  }
+
+  template <typename UnaryPredicate>
+  size_type remove_if(UnaryPredicate pred) {
+    size_type removed = 0;
+    for (ForwardNodeBase *prev = &head_; prev->next_;) {
+      if (pred(valueOf(prev->next_))) {
+        erase_after(iterator(prev));
+        ++removed;
+      } else {
+        prev = prev->next_;
+      }
+    }
+    return removed;
+  }
+
+ private:
+  class ForwardIterator {
+   public:
+    friend class forward_list;
+    ForwardIterator(ForwardNodeBase *node) : it(node) {}
+
+    ForwardIterator &operator++() {
+      it = it->next_;
+      return *this;
+    }
+
+    ForwardIterator operator++(int) {
+      ForwardIterator temp = *this;
+      it = it->next_;
+      return temp;
+    }
+
+    bool operator==(const ForwardIterator &l) const { return it == l.it; }
+
+    bool operator!=(const ForwardIterator &l) const { return it != l.it; }
+
+    reference operator*() const { return valueOf(it); }
+
+    T *operator->() const { return &valueOf(it); }
+
+   private:
+    ForwardNodeBase *it;
+  };
+  class ForwardConstIterator {
+   public:
+    friend class forward_list;
+    ForwardConstIterator(const iterator &other) : it(other.it) {}
+
+    ForwardConstIterator(ForwardNodeBase *node) : it(node) {}
+
+    ForwardConstIterator &operator++() {
+      it = it->next_;
+      return *this;
+    }
+
+    ForwardConstIterator operator++(int) {
+      ForwardConstIterator temp = *this;
+      it = it->next_;
+      return temp;
+    }
+
+    bool operator==(const ForwardConstIterator &l) const { return it == l.it; }
+
+    bool operator!=(const ForwardConstIterator &l) const { return it != l.it; }
+
+    const_reference operator*() const { return valueOf(it); }
+
+    const T *operator->() const { return &valueOf(it); }
+
+   private:
+    ForwardNodeBase *it;
+  };
+
+  struct ForwardNodeBase {
+    ForwardNodeBase *next_;
+  };
+  struct ForwardNode : ForwardNodeBase {
+    value_type value_;
+    template <typename... Args>
+    ForwardNode(Args &&...args)
+        : ForwardNodeBase{nullptr}, value_(std::forward<Args>(args)...) {}
+  };
+
+  using Pool = pool_type;
+
+  ForwardNodeBase head_;
+  // Пул берётся при первой вставке, если не был передан в конструктор.
+  std::shared_ptr<Pool> pool_;
+
+  static reference valueOf(ForwardNodeBase *node) noexcept {
+    return static_cast<ForwardNode *>(node)->value_;
+  }
+
+  template <typename... Args>
+  ForwardNode *createNode(Args &&...args) {
+    Pool::resolve(pool_);
+    if (!pool_) pool_ = default_pool();
+    void *memory = pool_->allocate();
+    try {
+      return new (memory) ForwardNode(std::forward<Args>(args)...);
+    } catch (...) {
+      pool_->deallocate(memory);
+      throw;
+    }
+  }
+
+  void destroyNode(ForwardNodeBase *node) noexcept {
+    ForwardNode *value_node = static_cast<ForwardNode *>(node);
+    value_node->~ForwardNode();
+    Pool::resolve(pool_);
+    pool_->deallocate(value_node);
+  }
+
+  template <typename Compare>
+  static ForwardNodeBase *mergeChains(ForwardNodeBase *first,
+                                      ForwardNodeBase *second, Compare &comp) {
+    ForwardNodeBase *head = nullptr;
+    ForwardNodeBase **tail = &head;
+    while (first && second) {
+      if (comp(valueOf(second), valueOf(first))) {
+        *tail = second;
+        second = second->next_;
+      } else {
+        *tail = first;
+        first = first->next_;
+      }
+      tail = &(*tail)->next_;
+    }
+    *tail = first ? first : second;
+    return head;
+  }
+};
+}  // namespace S21
+
+#endif  // CONTAINERS_SRC_S21_FORWARD_LIST_H_
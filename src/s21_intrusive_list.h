@@ -0,0 +1,383 @@
+#ifndef CONTAINERS_SRC_S21_INTRUSIVE_LIST_H_
+#define CONTAINERS_SRC_S21_INTRUSIVE_LIST_H_
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace S21 {
+template <typename T, auto Hook>
+class intrusive_list;
+
+// Хук встраивается в элемент как член класса и хранит связи списка. Копия
+// элемента получает несвязанный хук. С AutoUnlink = true элемент сам
+// выходит из списка в деструкторе или по unlink().
+template <bool AutoUnlink>
+class basic_list_hook {
+ public:
+  basic_list_hook() noexcept : prev_(nullptr), next_(nullptr) {}
+  basic_list_hook(const basic_list_hook &) noexcept : basic_list_hook() {}
+  basic_list_hook &operator=(const basic_list_hook &) noexcept {
+    return *this;
+  }
+  ~basic_list_hook() {
+    if constexpr (AutoUnlink) unlinkSelf();
+  }
+
+  bool is_linked() const noexcept { return next_ != nullptr; }
+
+  // Для list_hook удалять элемент нужно через intrusive_list::erase, иначе
+  // список не узнает об изменении размера.
+  void unlink() noexcept {
+    static_assert(AutoUnlink, "use intrusive_list::erase for list_hook");
+    unlinkSelf();
+  }
+
+ private:
+  template <typename, auto>
+  friend class intrusive_list;
+
+  void unlinkSelf() noexcept {
+    if (next_) {
+      prev_->next_ = next_;
+      next_->prev_ = prev_;
+      prev_ = next_ = nullptr;
+    }
+  }
+
+  basic_list_hook *prev_;
+  basic_list_hook *next_;
+};
+
+using list_hook = basic_list_hook<false>;
+using auto_unlink_hook = basic_list_hook<true>;
+
+namespace intrusive_detail {
+template <typename MemberPointer>
+struct MemberTraits;
+
+template <typename Class, typename Member>
+struct MemberTraits<Member Class::*> {
+  using class_type = Class;
+  using member_type = Member;
+};
+}  // namespace intrusive_detail
+
+// Список объектов, которыми владеет кто-то другой. Связи лежат в хуке внутри
+// T (Hook — указатель на член, например &Connection::hook), поэтому вставка
+// и удаление не выделяют память, а элемент удаляется по ссылке за O(1).
+// Со списком на auto_unlink_hook size() работает за O(n): элементы могут
+// покинуть список без его участия.
+template <typename T, auto Hook>
+class intrusive_list {
+  using Traits = intrusive_detail::MemberTraits<decltype(Hook)>;
+  using hook_type = typename Traits::member_type;
+  static_assert(std::is_same_v<typename Traits::class_type, T>,
+                "Hook must be a member of T");
+  static_assert(std::is_same_v<hook_type, list_hook> ||
+                    std::is_same_v<hook_type, auto_unlink_hook>,
+                "Hook must be list_hook or auto_unlink_hook");
+  // Элемент восстанавливается по хуку через смещение члена, а оно
+  // определено, как для offsetof, только у классов со standard layout.
+  static_assert(std::is_standard_layout_v<T>,
+                "intrusive_list requires a standard-layout T");
+  static constexpr bool kConstantTimeSize =
+      std::is_same_v<hook_type, list_hook>;
+
+  class IntrusiveIterator;
+  class IntrusiveConstIterator;
+
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using iterator = IntrusiveIterator;
+  using const_iterator = IntrusiveConstIterator;
+  using size_type = std::size_t;
+
+  intrusive_list() noexcept : size_(0) {
+    sentinel_.prev_ = sentinel_.next_ = &sentinel_;
+  }
+
+  intrusive_list(const intrusive_list &) = delete;
+  intrusive_list &operator=(const intrusive_list &) = delete;
+
+  intrusive_list(intrusive_list &&l) noexcept : intrusive_list() { swap(l); }
+
+  intrusive_list &operator=(intrusive_list &&l) noexcept {
+    if (this != &l) {
+      clear();
+      swap(l);
+    }
+    return *this;
+  }
+
+  // Элементы не уничтожаются, только отцепляются.
+  ~intrusive_list() { clear(); }
+
+  reference front() { return *owner(sentinel_.next_); }
+  reference back() { return *owner(sentinel_.prev_); }
+  const_reference front() const { return *owner(sentinel_.next_); }
+  const_reference back() const { return *owner(sentinel_.prev_); }
+
+  iterator begin() noexcept { return iterator(sentinel_.next_); }
+  iterator end() noexcept { return iterator(&sentinel_); }
+  const_iterator begin() const noexcept {
+    return const_iterator(sentinel_.next_);
+  }
+  const_iterator end() const noexcept {
+    return const_iterator(const_cast<hook_type *>(&sentinel_));
+  }
+
+  iterator iterator_to(reference value) noexcept {
+    return iterator(&(value.*Hook));
+  }
+  const_iterator iterator_to(const_reference value) const noexcept {
+    return const_iterator(const_cast<hook_type *>(&(value.*Hook)));
+  }
+
+  bool empty() const noexcept { return sentinel_.next_ == &sentinel_; }
+  size_type size() const noexcept {
+    if constexpr (kConstantTimeSize) {
+      return size_;
+    } else {
+      size_type count = 0;
+      for (const_iterator it = begin(); it != end(); ++it) ++count;
+      return count;
+    }
+  }
+
+  void clear() noexcept {
+    hook_type *node = sentinel_.next_;
+    while (node != &sentinel_) {
+      hook_type *next = node->next_;
+      node->prev_ = node->next_ = nullptr;
+      node = next;
+    }
+    sentinel_.prev_ = sentinel_.next_ = &sentinel_;
+    size_ = 0;
+  }
+
+  iterator insert(const_iterator pos, reference value) noexcept {
+    hook_type *node = &(value.*Hook);
+    linkBefore(pos.it, node);
+    return iterator(node);
+  }
+
+  void push_back(reference value) noexcept { insert(end(), value); }
+  void push_front(reference value) noexcept { insert(begin(), value); }
+
+  void pop_back() noexcept {
+    if (!empty()) unlinkNode(sentinel_.prev_);
+  }
+  void pop_front() noexcept {
+    if (!empty()) unlinkNode(sentinel_.next_);
+  }
+
+  iterator erase(const_iterator pos) noexcept {
+    hook_type *next = pos.it->next_;
+    unlinkNode(pos.it);
+    return iterator(next);
+  }
+
+  // Удаление по ссылке на элемент, без поиска.
+  void erase(reference value) noexcept { unlinkNode(&(value.*Hook)); }
+
+  void swap(intrusive_list &l) noexcept {
+    if (this == &l) return;
+    const bool was_empty = empty();
+    const bool other_was_empty = l.empty();
+    std::swap(sentinel_.prev_, l.sentinel_.prev_);
+    std::swap(sentinel_.next_, l.sentinel_.next_);
+    std::swap(size_, l.size_);
+    attachSentinel(other_was_empty);
+    l.attachSentinel(was_empty);
+  }
+
+  // splice, как и у S21::List, только перецепляет хуки.
+  void splice(const_iterator pos, intrusive_list &l) noexcept {
+    if (this == &l || l.empty()) return;
+    transfer(pos.it, l.sentinel_.next_, &l.sentinel_);
+    size_ += l.size_;
+    l.size_ = 0;
+  }
+
+  void splice(const_iterator pos, intrusive_list &l,
+              const_iterator it) noexcept {
+    hook_type *next = it.it->next_;
+    if (pos.it == it.it || pos.it == next) return;
+    if (this != &l) {
+      --l.size_;
+      ++size_;
+    }
+    transfer(pos.it, it.it, next);
+  }
+
+  void splice(const_iterator pos, intrusive_list &l, const_iterator first,
+              const_iterator last) noexcept {
+    size_type count = 0;
+    if (kConstantTimeSize && this != &l)
+      for (const_iterator it = first; it != last; ++it) ++count;
+    splice(pos, l, first, last, count);
+  }
+
+  void splice(const_iterator pos, intrusive_list &l, const_iterator first,
+              const_iterator last, size_type count) noexcept {
+    if (first == last) return;
+    if (this != &l) {
+      l.size_ -= count;
+      size_ += count;
+    }
+    transfer(pos.it, first.it, last.it);
+  }
+
+ private:
+  class IntrusiveIterator {
+   public:
+    friend class intrusive_list;
+    IntrusiveIterator(hook_type *node) : it(node) {}
+
+    IntrusiveIterator &operator++() {
+      it = intrusive_list::next(it);
+      return *this;
+    }
+
+    IntrusiveIterator &operator--() {
+      it = intrusive_list::prev(it);
+      return *this;
+    }
+
+    IntrusiveIterator operator++(int) {
+      IntrusiveIterator temp = *this;
+      ++*this;
+      return temp;
+    }
+
+    IntrusiveIterator operator--(int) {
+      IntrusiveIterator temp = *this;
+      --*this;
+      return temp;
+    }
+
+    bool operator==(const IntrusiveIterator &l) const { return it == l.it; }
+
+    bool operator!=(const IntrusiveIterator &l) const { return it != l.it; }
+
+    reference operator*() const { return *owner(it); }
+
+    T *operator->() const { return owner(it); }
+
+   private:
+    hook_type *it;
+  };
+  class IntrusiveConstIterator {
+   public:
+    friend class intrusive_list;
+    IntrusiveConstIterator(const iterator &other) : it(other.it) {}
+
+    IntrusiveConstIterator(hook_type *node) : it(node) {}
+
+    IntrusiveConstIterator &operator++() {
+      it = intrusive_list::next(it);
+      return *this;
+    }
+
+    IntrusiveConstIterator &operator--() {
+      it = intrusive_list::prev(it);
+      return *this;
+    }
+
+    IntrusiveConstIterator operator++(int) {
+      IntrusiveConstIterator temp = *this;
+      ++*this;
+      return temp;
+    }
+
+    IntrusiveConstIterator operator--(int) {
+      IntrusiveConstIterator temp = *this;
+      --*this;
+      return temp;
+    }
+
+    bool operator==(const IntrusiveConstIterator &l) const {
+      return it == l.it;
+    }
+
+    bool operator!=(const IntrusiveConstIterator &l) const {
+      return it != l.it;
+    }
+
+    const_reference operator*() const { return *owner(it); }
+
+    const T *operator->() const { return owner(it); }
+
+   private:
+    hook_type *it;
+  };
+
+  static hook_type *next(hook_type *node) noexcept { return node->next_; }
+  static hook_type *prev(hook_type *node) noexcept { return node->prev_; }
+
+  // Восстанавливает адрес элемента по адресу его хука.
+  static T *owner(hook_type *node) noexcept {
+    return reinterpret_cast<T *>(reinterpret_cast<char *>(node) -
+                                 hookOffset());
+  }
+
+  // То же, что offsetof(T, hook), но offsetof не принимает указатель на
+  // член. Считается один раз: объект T в probe не создаётся, берётся только
+  // адрес члена.
+  static std::ptrdiff_t hookOffset() noexcept {
+    static const std::ptrdiff_t offset = [] {
+      union Probe {
+        Probe() {}
+        ~Probe() {}
+        T object;
+      } probe;
+      return reinterpret_cast<char *>(&(probe.object.*Hook)) -
+             reinterpret_cast<char *>(&probe.object);
+    }();
+    return offset;
+  }
+
+  void attachSentinel(bool was_empty) noexcept {
+    if (was_empty) {
+      sentinel_.prev_ = sentinel_.next_ = &sentinel_;
+    } else {
+      sentinel_.next_->prev_ = &sentinel_;
+      sentinel_.prev_->next_ = &sentinel_;
+    }
+  }
+
+  void linkBefore(hook_type *pos, hook_type *node) noexcept {
+    node->prev_ = pos->prev_;
+    node->next_ = pos;
+    pos->prev_->next_ = node;
+    pos->prev_ = node;
+    ++size_;
+  }
+
+  void unlinkNode(hook_type *node) noexcept {
+    node->unlinkSelf();
+    --size_;
+  }
+
+  static void transfer(hook_type *pos, hook_type *first,
+                       hook_type *last) noexcept {
+    if (first == last || pos == first || pos == last) return;
+    hook_type *tail = last->prev_;
+    first->prev_->next_ = last;
+    last->prev_ = first->prev_;
+    tail->next_ = pos;
+    first->prev_ = pos->prev_;
+    pos->prev_->next_ = first;
+    pos->prev_ = tail;
+  }
+
+  hook_type sentinel_;
+  // Для auto_unlink_hook не используется.
+  size_type size_;
+};
+}  // namespace S21
+
+#endif  // CONTAINERS_SRC_S21_INTRUSIVE_LIST_H_
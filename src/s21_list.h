@@ -2,16 +2,29 @@
 #define CONTAINERS_SRC_S21_LIST_H_
 
 #include <cstddef>
+#include <functional>
 #include <initializer_list>
 #include <limits>
+#include <memory>
+#include <new>
 #include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "s21_node_pool.h"
 namespace S21 {
 template <typename T>
 class List {
+  struct ListNodeBase;
   struct ListNode;
   class ListIterator;
   class ListConstIterator;
 
+  // Параллельная сортировка вынесена в s21_list_parallel_sort.h, чтобы
+  // список не зависел от пула потоков.
+  template <typename U, typename Compare>
+  friend void parallel_sort(List<U> &list, std::size_t threads, Compare comp);
+
  public:
   using value_type = T;
   using reference = T &;
@@ -20,44 +33,30 @@ class List {
   using const_iterator = ListConstIterator;
   using size_type = std::size_t;
 
-  List() : sentinel_(new ListNode(T())), size_(0) {
-    sentinel_->next_ = sentinel_;
-    sentinel_->prev_ = sentinel_;
-  }
+  // sentinel_ хранится внутри объекта и не содержит значения: пустой список
+  // не создаёт ни одного T и не обращается к куче.
+  List() noexcept : sentinel_{&sentinel_, &sentinel_}, size_(0) {}
 
-  List(size_type n) : sentinel_(new ListNode(T())), size_(0) {
-    for (; n > 0; --n) push_back(T{});
+  List(size_type n) : List() {
+    for (; n > 0; --n) emplace_back();
   }
 
-  List(std::initializer_list<value_type> const &items)
-      : sentinel_(new ListNode(T())), size_(0) {
+  List(std::initializer_list<value_type> const &items) : List() {
     for (auto &i : items) push_back(i);
   }
 
-  List(const List &l) : sentinel_(new ListNode(T())), size_(0) {
-    sentinel_->next_ = sentinel_;
-    sentinel_->prev_ = sentinel_;
+  List(const List &l) : List() {
     for (const_iterator it = l.begin(); it != l.end(); ++it) push_back(*it);
   }
 
-  List(List &&l) : sentinel_(std::move(l.sentinel_)), size_(l.size_) {
-    l.sentinel_ = nullptr;
-    l.size_ = 0;
-    // delete l.sentinel_;
-  }
+  List(List &&l) noexcept : List() { swap(l); }
 
-  ~List() {
-    while (size_) pop_back();
-    delete sentinel_;
-  }
+  ~List() { clear(); }
 
-  List<T> &operator=(List &&l) {
+  List<T> &operator=(List &&l) noexcept {
     if (this != &l) {
-      clear();
-      delete sentinel_;
-      new (this) List(std::move(l));
-      l.sentinel_ = nullptr;
-      l.size_ = 0;
+      List tmp(std::move(l));
+      swap(tmp);
     }
     return *this;
   }
@@ -72,7 +71,7 @@ class List {
 
   const_reference front() const {
     if (size_)
-      return sentinel_->next_->value_;
+      return valueOf(sentinel_.next_);
     else {
       static const_reference default_value_{};
       return default_value_;
@@ -81,208 +80,378 @@ class List {
 
   const_reference back() const {
     if (size_)
-      return sentinel_->prev_->value_;
+      return valueOf(sentinel_.prev_);
     else {
       static const_reference default_value_{};
       return default_value_;
     }
   }
 
-  iterator begin() { return iterator(sentinel_->next_); }
+  iterator begin() { return iterator(sentinel_.next_); }
 
-  iterator end() { return iterator(sentinel_); }
+  iterator end() { return iterator(&sentinel_); }
 
-  const_iterator begin() const { return const_iterator(sentinel_->next_); }
+  const_iterator begin() const { return const_iterator(sentinel_.next_); }
 
-  const_iterator end() const { return const_iterator(sentinel_); }
+  const_iterator end() const {
+    return const_iterator(const_cast<ListNodeBase *>(&sentinel_));
+  }
 
   bool empty() { return size_ == 0; }
   size_type size() { return size_; }
   size_type max_size() { return std::numeric_limits<size_type>::max(); }
 
   void clear() {
-    while (size_) pop_back();
+    Pool::resolve(pool_);
+    // Если пул принадлежит только этому списку, узлы не возвращаются в него
+    // по одному: после деструкторов значений все блоки освобождаются разом.
+    const bool exclusive = pool_.use_count() == 1;
+    if (!exclusive || !std::is_trivially_destructible_v<T>) {
+      ListNodeBase *node = sentinel_.next_;
+      for (; size_; --size_) {
+        ListNodeBase *next = node->next_;
+        ListNode *value_node = static_cast<ListNode *>(node);
+        value_node->~ListNode();
+        if (!exclusive) pool_->deallocate(value_node);
+        node = next;
+      }
+    }
+    // Общий пул остаётся другим спискам, этот список снова независим.
+    if (exclusive)
+      pool_->release();
+    else
+      pool_.reset();
+    size_ = 0;
+    sentinel_.next_ = sentinel_.prev_ = &sentinel_;
   }
 
   iterator insert(iterator pos, const_reference value_) {
-    ListNode *newNode = new ListNode(value_);
-    pos.it->prev_->next_ = newNode;
-    newNode->prev_ = pos.it->prev_;
-    pos.it->prev_ = newNode;
-    newNode->next_ = pos.it;
-    size_++;
+    return emplace(pos, value_);
+  }
+
+  iterator insert(iterator pos, value_type &&value_) {
+    return emplace(pos, std::move(value_));
+  }
+
+  // Значение создаётся прямо в узле из аргументов конструктора T.
+  template <typename... Args>
+  iterator emplace(const_iterator pos, Args &&...args) {
+    ListNodeBase *newNode = createNode(std::forward<Args>(args)...);
+    linkBefore(pos.it, newNode);
     return iterator(newNode);
   }
 
+  template <typename... Args>
+  reference emplace_back(Args &&...args) {
+    ListNodeBase *newNode = createNode(std::forward<Args>(args)...);
+    linkBefore(&sentinel_, newNode);
+    return valueOf(newNode);
+  }
+
+  template <typename... Args>
+  reference emplace_front(Args &&...args) {
+    ListNodeBase *newNode = createNode(std::forward<Args>(args)...);
+    linkBefore(sentinel_.next_, newNode);
+    return valueOf(newNode);
+  }
+
   void erase(iterator pos) {
-    if (size_) {
-      ListNode *tmp = pos.it;
-      if (size_ == 1) {
-        sentinel_->next_ = sentinel_->prev_ = sentinel_;
-        pos = iterator(sentinel_);
-      } else {
-        tmp->next_->prev_ = tmp->prev_;
-        tmp->prev_->next_ = tmp->next_;
-        pos = iterator(tmp->next_);
-      }
-      delete tmp;
-      size_--;
-    }
+    if (size_) eraseNode(pos.it);
   }
 
-  void push_back(const_reference value_) {
-    ListNode *newNode = new ListNode(value_);
-    if (!size_) {
-      newNode->next_ = newNode->prev_ = sentinel_;
-      sentinel_->prev_ = sentinel_->next_ = newNode;
-    } else {
-      sentinel_->prev_->next_ = newNode;
-      newNode->next_ = sentinel_;
-      newNode->prev_ = sentinel_->prev_;
-      sentinel_->prev_ = newNode;
+  void push_back(const_reference value_) { emplace_back(value_); }
+
+  void push_back(value_type &&value_) { emplace_back(std::move(value_)); }
+
+  void pop_back() {
+    if (size_) eraseNode(sentinel_.prev_);
+  }
+
+  void push_front(const_reference value_) { emplace_front(value_); }
+
+  void push_front(value_type &&value_) { emplace_front(std::move(value_)); }
+
+  void pop_front() {
+    if (size_) eraseNode(sentinel_.next_);
+  }
+
+  void swap(List &l) noexcept {
+    if (this != &l) {
+      std::swap(sentinel_, l.sentinel_);
+      std::swap(size_, l.size_);
+      std::swap(pool_, l.pool_);
+      attachSentinel();
+      l.attachSentinel();
     }
-    size_++;
   }
 
-  void pop_back() {
-    if (size_) {
-      ListNode *tmp = sentinel_->prev_;
-      if (size_ == 1) {
-        sentinel_->next_ = sentinel_;
-        sentinel_->prev_ = sentinel_;
+  void merge(List &l) { merge(l, std::less<value_type>()); }
+
+  // Узлы l вплетаются в этот список без копирования и выделения памяти.
+  // Пулы списков объединяются так же, как в splice. Размеры обоих списков
+  // обновляются на каждом переносе, поэтому если comp бросит, оба списка
+  // останутся целыми.
+  template <typename Compare>
+  void merge(List &l, Compare comp) {
+    if (this == &l || !l.size_) return;
+    Pool::join(pool_, l.pool_);
+    ListNodeBase *first = sentinel_.next_;
+    ListNodeBase *second = l.sentinel_.next_;
+    while (first != &sentinel_ && second != &l.sentinel_) {
+      if (comp(valueOf(second), valueOf(first))) {
+        ListNodeBase *next = second->next_;
+        transfer(first, second, next);
+        ++size_;
+        --l.size_;
+        second = next;
       } else {
-        tmp->prev_->next_ = sentinel_;
-        sentinel_->prev_ = tmp->prev_;
+        first = first->next_;
       }
-      delete tmp;
-      size_--;
-    } else {  // Повтор ошибки оригинала
-      int *ptr = reinterpret_cast<int *>(0x10);
-      delete ptr;
     }
+    transfer(&sentinel_, second, &l.sentinel_);
+    size_ += l.size_;
+    l.size_ = 0;
+    l.dropPoolIfEmpty();
   }
 
-  void push_front(const_reference value_) {
-    ListNode *newNode = new ListNode(value_);
-    if (!size_) {
-      newNode->next_ = newNode->prev_ = sentinel_;
-      sentinel_->prev_ = sentinel_->next_ = newNode;
-    } else {
-      sentinel_->next_->prev_ = newNode;
-      newNode->prev_ = sentinel_;
-      newNode->next_ = sentinel_->next_;
-      sentinel_->next_ = newNode;
-    }
-    size_++;
+  // Все операции splice только перецепляют узлы и не выделяют память.
+  // Перенесённые узлы остаются в пуле l, поэтому пулы обоих списков
+  // объединяются в один, и пока оба списка не пусты, они делят его:
+  // - пул не потокобезопасен, такие списки нельзя менять из разных потоков
+  //   без общей блокировки;
+  // - блоки пула освобождаются, только когда последний из делящих его
+  //   списков очищен или уничтожен, до тех пор clear() одного из них лишь
+  //   возвращает узлы в общий пул.
+  // Список, отдавший все узлы или очищенный clear(), отпускает общий пул и
+  // дальше выделяет узлы из своего.
+  void splice(const_iterator pos, List &l) {
+    if (this == &l || !l.size_) return;
+    Pool::join(pool_, l.pool_);
+    transfer(pos.it, l.sentinel_.next_, &l.sentinel_);
+    size_ += l.size_;
+    l.size_ = 0;
+    l.dropPoolIfEmpty();
   }
 
-  void pop_front() {
-    if (size_) {
-      ListNode *tmp = sentinel_->next_;
-      if (size_ == 1) {
-        sentinel_->next_ = sentinel_;
-        sentinel_->prev_ = sentinel_;
-      } else {
-        tmp->next_->prev_ = sentinel_;
-        sentinel_->next_ = tmp->next_;
-      }
-      delete tmp;
-      size_--;
-    } else {  // Повтор ошибки оригинала
-      int *ptr = reinterpret_cast<int *>(0x10);
-      delete ptr;
+  // Переносит один узел it из l (l может совпадать с *this) перед pos.
+  void splice(const_iterator pos, List &l, const_iterator it) {
+    ListNodeBase *next = it.it->next_;
+    if (pos.it == it.it || pos.it == next) return;
+    if (this != &l) {
+      Pool::join(pool_, l.pool_);
+      --l.size_;
+      ++size_;
     }
+    transfer(pos.it, it.it, next);
+    l.dropPoolIfEmpty();
+  }
+
+  // Диапазон из другого списка требует подсчёта узлов, O(n). Если их число
+  // известно заранее, перегрузка с count работает за O(1).
+  void splice(const_iterator pos, List &l, const_iterator first,
+              const_iterator last) {
+    size_type count = 0;
+    if (this != &l)
+      for (const_iterator it = first; it != last; ++it) ++count;
+    splice(pos, l, first, last, count);
   }
 
-  void swap(List &l) {
+  void splice(const_iterator pos, List &l, const_iterator first,
+              const_iterator last, size_type count) {
+    if (first == last) return;
     if (this != &l) {
-      std::swap(sentinel_, l.sentinel_);
-      std::swap(size_, l.size_);
+      Pool::join(pool_, l.pool_);
+      l.size_ -= count;
+      size_ += count;
     }
+    transfer(pos.it, first.it, last.it);
+    l.dropPoolIfEmpty();
   }
 
-  void merge(List &l) {
-    List tmp;
-    auto itTmp = begin();
-    auto itL = l.begin();
-    while (itTmp != end() && itL != l.end())
-      if (*itTmp < *itL) {
-        tmp.push_back(*itTmp);
-        ++itTmp;
-      } else {
-        tmp.push_back(*itL);
-        ++itL;
+  // Меняет местами next_ и prev_ у каждого узла, включая sentinel_.
+  void reverse() noexcept {
+    if (size_ < 2) return;
+    ListNodeBase *node = &sentinel_;
+    do {
+      std::swap(node->next_, node->prev_);
+      node = node->prev_;
+    } while (node != &sentinel_);
+  }
+
+  void unique() { unique(std::equal_to<value_type>()); }
+
+  // Удаляет за один проход узлы, равные предыдущему оставленному.
+  template <typename BinaryPredicate>
+  void unique(BinaryPredicate pred) {
+    if (size_ < 2) return;
+    ListNodeBase *kept = sentinel_.next_;
+    for (ListNodeBase *node = kept->next_; node != &sentinel_;) {
+      ListNodeBase *next = node->next_;
+      if (pred(valueOf(kept), valueOf(node)))
+        eraseNode(node);
+      else
+        kept = node;
+      node = next;
+    }
+  }
+
+  size_type remove(const_reference value) {
+    // value может лежать в самом списке: такой узел удаляется последним.
+    ListNodeBase *self = nullptr;
+    size_type removed = 0;
+    for (ListNodeBase *node = sentinel_.next_; node != &sentinel_;) {
+      ListNodeBase *next = node->next_;
+      if (&valueOf(node) == &value) {
+        self = node;
+      } else if (valueOf(node) == value) {
+        eraseNode(node);
+        ++removed;
       }
-    while (itTmp != end()) {
-      tmp.push_back(*itTmp);
-      ++itTmp;
+      node = next;
     }
-    while (itL != l.end()) {
-      tmp.push_back(*itL);
-      ++itL;
+    if (self) {
+      eraseNode(self);
+      ++removed;
     }
-    clear();
-    swap(tmp);
-    l.clear();
+    return removed;
   }
 
-  void splice(const_iterator pos, List &l) {
-    if (size_ && l.size_) {
-      l.sentinel_->next_->prev_ = pos.it->prev_;
-      l.sentinel_->prev_->next_ = pos.it;
-      pos.it->prev_->next_ = l.sentinel_->next_;
-      pos.it->prev_ = l.sentinel_->prev_;
-      size_ += l.size_;
-      l.size_ = 0;
-      l.sentinel_->next_ = l.sentinel_;
-      l.sentinel_->prev_ = l.sentinel_;
-    } else if (!size_ && l.size_) {
-      std::swap(*this, l);
-      l.size_ = 0;
-      l.sentinel_->next_ = l.sentinel_;
-      l.sentinel_->prev_ = l.sentinel_;
+  template <typename UnaryPredicate>
+  size_type remove_if(UnaryPredicate pred) {
+    size_type removed = 0;
+    for (ListNodeBase *node = sentinel_.next_; node != &sentinel_;) {
+      ListNodeBase *next = node->next_;
+      if (pred(valueOf(node))) {
+        eraseNode(node);
+        ++removed;
+      }
+      node = next;
+    }
+    return removed;
+  }
+
+  void sort() { sort(std::less<value_type>()); }
+
+  // Устойчивая восходящая сортировка слиянием: узлы только перецепляются,
+  // значения не копируются, O(n log n) в худшем случае. Если comp бросит,
+  // список останется в исходном порядке.
+  template <typename Compare>
+  void sort(Compare comp) {
+    if (size_ < 2) return;
+    sentinel_.prev_->next_ = nullptr;
+    ListNodeBase *sorted;
+    try {
+      sorted = sortChain(sentinel_.next_, comp);
+    } catch (...) {
+      restoreNextLinks();
+      throw;
     }
+    relinkChain(sorted);
+  }
+
+  // Обходы всего списка без итераторов. Обход разбросанных по памяти узлов
+  // упирается в задержку загрузки next_; ускоряет его relayout().
+  template <typename Visitor>
+  Visitor for_each(Visitor visit) {
+    walk([&visit](ListNodeBase *node) {
+      visit(valueOf(node));
+      return false;
+    });
+    return visit;
+  }
+
+  template <typename Visitor>
+  Visitor for_each(Visitor visit) const {
+    walk([&visit](ListNodeBase *node) {
+      visit(static_cast<const_reference>(valueOf(node)));
+      return false;
+    });
+    return visit;
   }
 
-  void reverse() {
-    auto itStart = begin();
-    auto itStop = --end();
-    for (size_type i = 0; i < size_ / 2; i++, ++itStart, --itStop)
-      std::swap(*itStart, *itStop);
+  template <typename U, typename BinaryOp = std::plus<>>
+  U accumulate(U init, BinaryOp op = BinaryOp()) const {
+    walk([&init, &op](ListNodeBase *node) {
+      init = op(std::move(init), static_cast<const_reference>(valueOf(node)));
+      return false;
+    });
+    return init;
   }
 
-  void unique() {
-    for (auto it = ++begin(), it2 = begin(); it != end(); ++it, ++it2)
-      if (*it == *it2) erase(it2--);
+  template <typename Predicate>
+  iterator find_if(Predicate pred) {
+    return iterator(walk([&pred](ListNodeBase *node) {
+      return static_cast<bool>(pred(valueOf(node)));
+    }));
   }
 
-  void sort() {
-    if (size_ > 1) quickSort(sentinel_->next_, sentinel_->prev_);
+  template <typename Predicate>
+  const_iterator find_if(Predicate pred) const {
+    return const_iterator(walk([&pred](ListNodeBase *node) {
+      const_reference value = valueOf(node);
+      return static_cast<bool>(pred(value));
+    }));
+  }
+
+  // Переносит значения в новые узлы, выделенные подряд в порядке списка.
+  // После вставок в случайные места и сортировки соседние элементы снова
+  // лежат в памяти рядом. Итераторы и ссылки на элементы становятся
+  // недействительными.
+  void relayout() {
+    if (size_ < 2) return;
+    Pool::resolve(pool_);
+    auto fresh = std::make_shared<Pool>();
+    ListNodeBase *node = sentinel_.next_;
+    try {
+      while (node != &sentinel_) {
+        ListNode *old_node = static_cast<ListNode *>(node);
+        void *memory = fresh->allocate();
+        ListNode *moved;
+        try {
+          moved =
+              new (memory) ListNode(std::move_if_noexcept(old_node->value_));
+        } catch (...) {
+          fresh->deallocate(memory);
+          throw;
+        }
+        moved->prev_ = node->prev_;
+        moved->next_ = node->next_;
+        node->prev_->next_ = moved;
+        node->next_->prev_ = moved;
+        node = node->next_;
+        old_node->~ListNode();
+        pool_->deallocate(old_node);
+      }
+    } catch (...) {
+      // Часть узлов уже в новом пуле: его память переходит к pool_.
+      Pool::join(pool_, fresh);
+      throw;
+    }
+    pool_ = std::move(fresh);
   }
 
   template <typename... Args>
   void insert_many_back(Args &&...args) {
-    ([&] { push_back(args); }(), ...);
+    (emplace_back(std::forward<Args>(args)), ...);
   }
 
   template <typename... Args>
   void insert_many_front(Args &&...args) {
-    iterator it = begin();
-    for (auto value_ : {std::forward<Args>(args)...}) insert(it, value_);
+    const_iterator it = begin();
+    (emplace(it, std::forward<Args>(args)), ...);
   }
 
   template <typename... Args>
   iterator insert_many(const_iterator pos, Args &&...args) {
-    iterator not_const_pos = pos.it;
-    ([&] { insert(not_const_pos, args); }(), ...);
-    return not_const_pos;
+    (emplace(pos, std::forward<Args>(args)), ...);
+    return iterator(pos.it);
   }
 
  private:
   class ListIterator {
    public:
     friend class List;
-    ListIterator(typename List<T>::ListNode *node) : it(node) {}
+    ListIterator(typename List<T>::ListNodeBase *node) : it(node) {}
 
     ListIterator &operator++() {
       it = it->next_;
@@ -310,17 +479,19 @@ class List {
 
     bool operator!=(const ListIterator &l) const { return it != l.it; }
 
-    reference operator*() const { return it->value_; }
+    reference operator*() const { return valueOf(it); }
+
+    T *operator->() const { return &valueOf(it); }
 
    private:
-    typename List<T>::ListNode *it;
+    typename List<T>::ListNodeBase *it;
   };
   class ListConstIterator {
    public:
     friend class List;
     ListConstIterator(const iterator &other) : it(other.it) {}
 
-    ListConstIterator(typename List<T>::ListNode *node) : it(node) {}
+    ListConstIterator(typename List<T>::ListNodeBase *node) : it(node) {}
 
     ListConstIterator &operator++() {
       it = it->next_;
@@ -348,41 +519,175 @@ class List {
 
     bool operator!=(const ListConstIterator &l) const { return it != l.it; }
 
-    const_reference operator*() const { return it->value_; }
+    const_reference operator*() const { return valueOf(it); }
+
+    const T *operator->() const { return &valueOf(it); }
 
    private:
-    typename List<T>::ListNode *it;
+    typename List<T>::ListNodeBase *it;
   };
-  struct ListNode {
+  // Связи узла вынесены в базу: sentinel_ состоит только из них.
+  struct ListNodeBase {
+    ListNodeBase *prev_;
+    ListNodeBase *next_;
+  };
+  struct ListNode : ListNodeBase {
     value_type value_;
-    ListNode *prev_;
-    ListNode *next_;
-    ListNode(const_reference val)
-        : value_(val), prev_(nullptr), next_(nullptr) {}
+    template <typename... Args>
+    ListNode(Args &&...args)
+        : ListNodeBase{nullptr, nullptr},
+          value_(std::forward<Args>(args)...) {}
   };
 
-  ListNode *sentinel_;
+  using Pool = NodePool<ListNode>;
+
+  ListNodeBase sentinel_;
   size_type size_;
+  // Пул создаётся при первой вставке, пустой список памяти под узлы не держит.
+  std::shared_ptr<Pool> pool_;
+
+  static reference valueOf(ListNodeBase *node) noexcept {
+    return static_cast<ListNode *>(node)->value_;
+  }
 
-  void quickSort(ListNode *start, ListNode *end) {
-    if (start != end && end != nullptr && start != end->next_) {
-      ListNode *pivot = partition(start, end);
-      quickSort(start, pivot->prev_);
-      quickSort(pivot->next_, end);
+  template <typename... Args>
+  ListNode *createNode(Args &&...args) {
+    Pool::resolve(pool_);
+    if (!pool_) pool_ = std::make_shared<Pool>();
+    void *memory = pool_->allocate();
+    try {
+      return new (memory) ListNode(std::forward<Args>(args)...);
+    } catch (...) {
+      pool_->deallocate(memory);
+      throw;
     }
   }
 
-  ListNode *partition(ListNode *start, ListNode *end) {
-    T pivotvalue_ = end->value_;
-    ListNode *i = start->prev_;
-    for (ListNode *j = start; j != end; j = j->next_)
-      if (j->value_ <= pivotvalue_) {
-        i = (i == nullptr) ? start : i->next_;
-        std::swap(i->value_, j->value_);
+  void dropPoolIfEmpty() noexcept {
+    if (!size_) pool_.reset();
+  }
+
+  void destroyNode(ListNodeBase *node) noexcept {
+    ListNode *value_node = static_cast<ListNode *>(node);
+    value_node->~ListNode();
+    Pool::resolve(pool_);
+    pool_->deallocate(value_node);
+  }
+
+  // После обмена sentinel_ между объектами соседи должны ссылаться на новый.
+  void attachSentinel() noexcept {
+    if (size_) {
+      sentinel_.next_->prev_ = &sentinel_;
+      sentinel_.prev_->next_ = &sentinel_;
+    } else {
+      sentinel_.next_ = sentinel_.prev_ = &sentinel_;
+    }
+  }
+
+  void linkBefore(ListNodeBase *pos, ListNodeBase *node) noexcept {
+    node->prev_ = pos->prev_;
+    node->next_ = pos;
+    pos->prev_->next_ = node;
+    pos->prev_ = node;
+    ++size_;
+  }
+
+  void eraseNode(ListNodeBase *node) noexcept {
+    node->prev_->next_ = node->next_;
+    node->next_->prev_ = node->prev_;
+    destroyNode(node);
+    --size_;
+  }
+
+  // Переносит узлы [first, last) перед pos, только перецепляя указатели.
+  static void transfer(ListNodeBase *pos, ListNodeBase *first,
+                       ListNodeBase *last) noexcept {
+    if (first == last || pos == first || pos == last) return;
+    ListNodeBase *tail = last->prev_;
+    first->prev_->next_ = last;
+    last->prev_ = first->prev_;
+    tail->next_ = pos;
+    first->prev_ = pos->prev_;
+    pos->prev_->next_ = first;
+    pos->prev_ = tail;
+  }
+
+  // Сливает две отсортированные цепочки, связанные только по next_. При
+  // равенстве первым идёт узел из first, что делает сортировку устойчивой.
+  template <typename Compare>
+  static ListNodeBase *mergeChains(ListNodeBase *first, ListNodeBase *second,
+                                   Compare &comp) {
+    ListNodeBase *head = nullptr;
+    ListNodeBase **tail = &head;
+    while (first && second) {
+      if (comp(valueOf(second), valueOf(first))) {
+        *tail = second;
+        second = second->next_;
+      } else {
+        *tail = first;
+        first = first->next_;
       }
-    i = (i == nullptr) ? start : i->next_;
-    std::swap(i->value_, end->value_);
-    return i;
+      tail = &(*tail)->next_;
+    }
+    *tail = first ? first : second;
+    return head;
+  }
+
+  // Вызывает step для узлов по порядку, пока он не вернёт true. Возвращает
+  // этот узел или sentinel_.
+  template <typename Step>
+  ListNodeBase *walk(Step step) const {
+    ListNodeBase *end = const_cast<ListNodeBase *>(&sentinel_);
+    for (ListNodeBase *node = sentinel_.next_; node != end;
+         node = node->next_)
+      if (step(node)) return node;
+    return end;
+  }
+
+  // Восходящая сортировка слиянием цепочки, связанной по next_.
+  template <typename Compare>
+  static ListNodeBase *sortChain(ListNodeBase *node, Compare &comp) {
+    // bins[i] хранит отсортированную цепочку из 2^i узлов (или пуст)
+    ListNodeBase *bins[std::numeric_limits<size_type>::digits] = {};
+    while (node) {
+      ListNodeBase *carry = node;
+      node = node->next_;
+      carry->next_ = nullptr;
+      size_type i = 0;
+      for (; bins[i]; ++i) {
+        carry = mergeChains(bins[i], carry, comp);
+        bins[i] = nullptr;
+      }
+      bins[i] = carry;
+    }
+    ListNodeBase *result = nullptr;
+    for (ListNodeBase *bin : bins)
+      if (bin) result = result ? mergeChains(bin, result, comp) : bin;
+    return result;
+  }
+
+  // sortChain и mergeChains меняют только next_, поэтому исходный порядок
+  // восстанавливается обратным проходом по prev_.
+  void restoreNextLinks() noexcept {
+    ListNodeBase *next = &sentinel_;
+    for (ListNodeBase *node = sentinel_.prev_; node != &sentinel_;
+         node = node->prev_) {
+      node->next_ = next;
+      next = node;
+    }
+    sentinel_.next_ = next;
+  }
+
+  // Замыкает цепочку по next_ на sentinel_ и восстанавливает prev_.
+  void relinkChain(ListNodeBase *head) {
+    ListNodeBase *prev = &sentinel_;
+    for (ListNodeBase *node = head; node; node = node->next_) {
+      node->prev_ = prev;
+      prev->next_ = node;
+      prev = node;
+    }
+    prev->next_ = &sentinel_;
+    sentinel_.prev_ = prev;
   }
 };
 
@@ -0,0 +1,65 @@
+#ifndef CONTAINERS_SRC_S21_LIST_PARALLEL_SORT_H_
+#define CONTAINERS_SRC_S21_LIST_PARALLEL_SORT_H_
+
+#include <algorithm>   // min
+#include <cstddef>     // size_t
+#include <functional>  // less
+#include <vector>      // vector
+
+#include "s21_list.h"
+#include "s21_thread_pool.h"
+
+namespace S21 {
+// Куски меньше этого размера сортируются в одном потоке.
+inline constexpr std::size_t kParallelSortGrain = std::size_t{1} << 14;
+
+// List::sort на нескольких потоках: список режется перецеплением на threads
+// кусков, куски сортируются параллельно и сливаются попарно, уровень за
+// уровнем, тоже параллельно. Значения не копируются, результат совпадает
+// с sort(). Куски выполняются на общем s21::thread_pool::shared(),
+// threads = 0 — по числу его рабочих. comp вызывается одновременно из
+// разных потоков и не должен бросать исключений.
+template <typename T, typename Compare>
+void parallel_sort(List<T> &list, std::size_t threads, Compare comp) {
+  using Node = typename List<T>::ListNodeBase;
+  s21::thread_pool &pool = s21::thread_pool::shared();
+  if (threads == 0) threads = pool.size();
+  threads = std::min(threads, list.size_ / kParallelSortGrain);
+  if (threads < 2) return list.sort(comp);
+  std::vector<Node *> chains(threads);
+  list.sentinel_.prev_->next_ = nullptr;
+  Node *node = list.sentinel_.next_;
+  for (std::size_t i = 0; i < threads; ++i) {
+    chains[i] = node;
+    std::size_t length =
+        list.size_ / threads + (i < list.size_ % threads ? 1 : 0);
+    for (; length > 1; --length) node = node->next_;
+    Node *next = node->next_;
+    node->next_ = nullptr;
+    node = next;
+  }
+  pool.parallel_for(threads, [&chains, &comp](std::size_t i) {
+    Compare local = comp;
+    chains[i] = List<T>::sortChain(chains[i], local);
+  });
+  // Сливаются соседние куски, левый идёт первым: порядок равных сохраняется
+  for (std::size_t step = 1; step < threads; step *= 2) {
+    pool.parallel_for((threads + 2 * step - 1) / (2 * step),
+                      [&chains, &comp, step, threads](std::size_t i) {
+                        std::size_t left = i * 2 * step, right = left + step;
+                        if (right >= threads) return;
+                        Compare local = comp;
+                        chains[left] = List<T>::mergeChains(
+                            chains[left], chains[right], local);
+                      });
+  }
+  list.relinkChain(chains[0]);
+}
+
+template <typename T>
+void parallel_sort(List<T> &list, std::size_t threads = 0) {
+  parallel_sort(list, threads, std::less<T>());
+}
+}  // namespace S21
+
+#endif  // CONTAINERS_SRC_S21_LIST_PARALLEL_SORT_H_
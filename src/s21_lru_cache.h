@@ -0,0 +1,219 @@
+#ifndef CONTAINERS_SRC_S21_LRU_CACHE_H_
+#define CONTAINERS_SRC_S21_LRU_CACHE_H_
+
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <unordered_map>
+#include <utility>
+
+#include "s21_list.h"
+namespace S21 {
+// LRU-кэш: записи лежат в S21::List от самой свежей к самой старой, а
+// хеш-индекс ссылается прямо на узлы списка. Поиск, обновление и вытеснение
+// выполняются за O(1): «освежение» записи — это splice узла в начало.
+//
+// Ограничений два, действуют оба: число записей и суммарная стоимость,
+// которую считает cost_function (например, размер значения в байтах).
+template <typename K, typename V, typename Hash = std::hash<K>,
+          typename KeyEqual = std::equal_to<K>>
+class lru_cache {
+ public:
+  using key_type = K;
+  using mapped_type = V;
+  using size_type = std::size_t;
+  using cost_function = std::function<size_type(const K &, const V &)>;
+  using eviction_callback = std::function<void(const K &, V &)>;
+
+  struct stats_type {
+    size_type hits = 0;
+    size_type misses = 0;
+    size_type evictions = 0;
+  };
+
+  static constexpr size_type kUnlimited = std::numeric_limits<size_type>::max();
+
+  explicit lru_cache(size_type max_entries)
+      : lru_cache(max_entries, kUnlimited, nullptr) {}
+
+  lru_cache(size_type max_entries, size_type max_cost, cost_function cost)
+      : max_entries_(max_entries),
+        max_cost_(max_cost),
+        cost_(0),
+        cost_function_(std::move(cost)) {}
+
+  // Индекс хранит ссылки на ключи внутри узлов, поэтому копирование запрещено.
+  lru_cache(const lru_cache &) = delete;
+  lru_cache &operator=(const lru_cache &) = delete;
+
+  // Возвращает указатель на значение и делает запись самой свежей.
+  V *get(const K &key) {
+    auto found = index_.find(key);
+    if (found == index_.end()) {
+      ++stats_.misses;
+      return nullptr;
+    }
+    ++stats_.hits;
+    entries_.splice(entries_.begin(), entries_, found->second);
+    return &found->second->value;
+  }
+
+  // Доступ без изменения порядка и статистики.
+  V *peek(const K &key) {
+    auto found = index_.find(key);
+    return found == index_.end() ? nullptr : &found->second->value;
+  }
+
+  bool touch(const K &key) {
+    auto found = index_.find(key);
+    if (found == index_.end()) return false;
+    entries_.splice(entries_.begin(), entries_, found->second);
+    return true;
+  }
+
+  bool contains(const K &key) const { return index_.count(key) != 0; }
+
+  // Вставляет или обновляет запись, затем вытесняет старые записи сверх
+  // лимитов. Запись, которая одна дороже max_cost, сразу вытесняется сама и
+  // не трогает остальные. Возвращает true, если ключа раньше не было.
+  template <typename Value>
+  bool put(const K &key, Value &&value) {
+    auto found = index_.find(key);
+    bool inserted = found == index_.end();
+    if (inserted) {
+      entries_.emplace_front(key, std::forward<Value>(value));
+      try {
+        index_.emplace(std::cref(entries_.begin()->key), entries_.begin());
+      } catch (...) {
+        entries_.pop_front();
+        throw;
+      }
+    } else {
+      found->second->value = std::forward<Value>(value);
+      entries_.splice(entries_.begin(), entries_, found->second);
+    }
+    // cost_ меняется, только когда новая стоимость посчитана: если
+    // присваивание или cost_function бросят, cost_ по-прежнему равна сумме
+    // стоимостей записей.
+    Entry &entry = *entries_.begin();
+    size_type cost = 1;
+    try {
+      if (cost_function_) cost = cost_function_(entry.key, entry.value);
+    } catch (...) {
+      if (inserted) {
+        index_.erase(entry.key);
+        entries_.pop_front();
+      }
+      throw;
+    }
+    cost_ = cost_ - entry.cost + cost;
+    entry.cost = cost;
+    if (entry.cost > max_cost_)
+      evictNode(entries_.begin());
+    else
+      shrink();
+    return inserted;
+  }
+
+  // Явное удаление: callback вытеснения не вызывается.
+  bool erase(const K &key) {
+    auto found = index_.find(key);
+    if (found == index_.end()) return false;
+    auto node = found->second;
+    cost_ -= node->cost;
+    index_.erase(found);
+    entries_.erase(node);
+    return true;
+  }
+
+  // Вытесняет самую старую запись.
+  bool evict() {
+    if (entries_.empty()) return false;
+    evictNode(--entries_.end());
+    return true;
+  }
+
+  void clear() {
+    index_.clear();
+    entries_.clear();
+    cost_ = 0;
+  }
+
+  void set_eviction_callback(eviction_callback callback) {
+    on_evict_ = std::move(callback);
+  }
+
+  void set_max_entries(size_type max_entries) {
+    max_entries_ = max_entries;
+    shrink();
+  }
+
+  void set_max_cost(size_type max_cost) {
+    max_cost_ = max_cost;
+    shrink();
+  }
+
+  bool empty() const noexcept { return index_.empty(); }
+  size_type size() const noexcept { return index_.size(); }
+  size_type cost() const noexcept { return cost_; }
+  size_type max_entries() const noexcept { return max_entries_; }
+  size_type max_cost() const noexcept { return max_cost_; }
+
+  const stats_type &stats() const noexcept { return stats_; }
+  void reset_stats() noexcept { stats_ = stats_type(); }
+
+  // Обход от самой свежей записи к самой старой.
+  template <typename Visitor>
+  void for_each(Visitor visit) const {
+    for (auto it = entries_.begin(); it != entries_.end(); ++it)
+      visit(it->key, it->value);
+  }
+
+ private:
+  struct Entry {
+    template <typename Value>
+    Entry(const K &k, Value &&v)
+        : key(k), value(std::forward<Value>(v)), cost(0) {}
+    K key;
+    V value;
+    size_type cost;
+  };
+
+  using Entries = List<Entry>;
+  using KeyRef = std::reference_wrapper<const K>;
+
+  struct KeyRefHash {
+    size_type operator()(const K &key) const { return Hash()(key); }
+  };
+  struct KeyRefEqual {
+    bool operator()(const K &a, const K &b) const { return KeyEqual()(a, b); }
+  };
+
+  void evictNode(typename Entries::iterator node) {
+    if (on_evict_) on_evict_(node->key, node->value);
+    cost_ -= node->cost;
+    index_.erase(node->key);
+    entries_.erase(node);
+    ++stats_.evictions;
+  }
+
+  void shrink() {
+    while (!entries_.empty() &&
+           (index_.size() > max_entries_ || cost_ > max_cost_))
+      evict();
+  }
+
+  size_type max_entries_;
+  size_type max_cost_;
+  size_type cost_;
+  cost_function cost_function_;
+  eviction_callback on_evict_;
+  stats_type stats_;
+  Entries entries_;
+  std::unordered_map<KeyRef, typename Entries::iterator, KeyRefHash,
+                     KeyRefEqual>
+      index_;
+};
+}  // namespace S21
+
+#endif  // CONTAINERS_SRC_S21_LRU_CACHE_H_
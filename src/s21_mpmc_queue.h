@@ -0,0 +1,173 @@
+#ifndef CONTAINERS_SRC_S21_MPMC_QUEUE_H_
+#define CONTAINERS_SRC_S21_MPMC_QUEUE_H_
+
+#include <atomic>       // atomic memory_order
+#include <cstddef>      // size_t ptrdiff_t
+#include <memory>       // allocator
+#include <new>          // placement new launder
+#include <type_traits>  // is_nothrow_move_*
+#include <utility>      // forward move
+
+#include "s21_spin_wait.h"
+
+namespace s21 {
+// Ограниченная неблокирующая очередь для многих производителей и многих
+// потребителей (схема Вьюкова). У каждой ячейки есть номер sequence:
+// sequence == pos — ячейка свободна для записи с позицией pos,
+// sequence == pos + 1 — в ней лежит элемент для чтения с позицией pos.
+// Позиции записи и чтения захватываются CAS, после чего поток работает со
+// своей ячейкой без гонок и публикует её новым sequence.
+//
+// Интерфейс повторяет s21::queue, но pop отдаёт элемент через out.
+// Захваченная ячейка обязана быть опубликована, поэтому перенос T не должен
+// бросать исключений.
+template <class T>
+class mpmc_queue {
+  static_assert(std::is_nothrow_move_constructible_v<T> &&
+                    std::is_nothrow_move_assignable_v<T>,
+                "mpmc_queue requires nothrow move");
+
+ public:
+  using value_type = T;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using size_type = std::size_t;
+
+  explicit mpmc_queue(size_type capacity)
+      : capacity_(roundUp(capacity)),
+        mask_(capacity_ - 1),
+        cells_(std::allocator<Cell>().allocate(capacity_)) {
+    for (size_type i = 0; i < capacity_; ++i)
+      new (cells_ + i) Cell{std::atomic<size_type>(i), {}};
+  }
+
+  mpmc_queue(const mpmc_queue &) = delete;
+  mpmc_queue &operator=(const mpmc_queue &) = delete;
+
+  ~mpmc_queue() {
+    size_type head = dequeue_pos_.load(std::memory_order_relaxed);
+    const size_type tail = enqueue_pos_.load(std::memory_order_relaxed);
+    for (; head != tail; ++head) cells_[head & mask_].value()->~value_type();
+    for (size_type i = 0; i < capacity_; ++i) cells_[i].~Cell();
+    std::allocator<Cell>().deallocate(cells_, capacity_);
+  }
+
+  bool try_push(const_reference value) { return try_emplace(value); }
+  bool try_push(value_type &&value) { return try_emplace(std::move(value)); }
+
+  template <typename... Args>
+  bool try_emplace(Args &&...args) {
+    if constexpr (std::is_nothrow_constructible_v<value_type, Args &&...>) {
+      return tryPublish(std::forward<Args>(args)...);
+    } else {
+      // Значение создаётся до захвата ячейки: исключение ничего не ломает.
+      value_type value(std::forward<Args>(args)...);
+      return tryPublish(std::move(value));
+    }
+  }
+
+  void push(const_reference value) {
+    spin_wait waiter;
+    while (!try_push(value)) waiter.wait();
+  }
+  void push(value_type &&value) {
+    spin_wait waiter;
+    while (!try_push(std::move(value))) waiter.wait();
+  }
+
+  bool try_pop(reference out) noexcept {
+    Cell *cell;
+    size_type pos = dequeue_pos_.load(std::memory_order_relaxed);
+    for (;;) {
+      cell = &cells_[pos & mask_];
+      const size_type seq = cell->sequence.load(std::memory_order_acquire);
+      const std::ptrdiff_t diff = static_cast<std::ptrdiff_t>(seq) -
+                                  static_cast<std::ptrdiff_t>(pos + 1);
+      if (diff == 0) {
+        if (dequeue_pos_.compare_exchange_weak(pos, pos + 1,
+                                               std::memory_order_relaxed))
+          break;
+      } else if (diff < 0) {
+        return false;
+      } else {
+        pos = dequeue_pos_.load(std::memory_order_relaxed);
+      }
+    }
+    value_type *item = cell->value();
+    out = std::move(*item);
+    item->~value_type();
+    cell->sequence.store(pos + capacity_, std::memory_order_release);
+    return true;
+  }
+
+  void pop(reference out) noexcept {
+    spin_wait waiter;
+    while (!try_pop(out)) waiter.wait();
+  }
+
+  // Первый элемент. Действительна, только пока никто не извлекает элементы.
+  const_reference front() const noexcept {
+    return *cells_[dequeue_pos_.load(std::memory_order_acquire) & mask_]
+                .value();
+  }
+
+  // Под нагрузкой значения приблизительные.
+  bool empty() const noexcept { return size() == 0; }
+  size_type size() const noexcept {
+    const size_type head = dequeue_pos_.load(std::memory_order_acquire);
+    const size_type tail = enqueue_pos_.load(std::memory_order_acquire);
+    return tail - head <= capacity_ ? tail - head : 0;
+  }
+  size_type capacity() const noexcept { return capacity_; }
+
+ private:
+  struct Cell {
+    std::atomic<size_type> sequence;
+    alignas(value_type) unsigned char storage[sizeof(value_type)];
+
+    value_type *value() noexcept {
+      return std::launder(reinterpret_cast<value_type *>(storage));
+    }
+  };
+
+  static size_type roundUp(size_type n) noexcept {
+    size_type capacity = 2;
+    while (capacity < n) capacity *= 2;
+    return capacity;
+  }
+
+  template <typename... Args>
+  bool tryPublish(Args &&...args) noexcept {
+    Cell *cell;
+    size_type pos = enqueue_pos_.load(std::memory_order_relaxed);
+    for (;;) {
+      cell = &cells_[pos & mask_];
+      const size_type seq = cell->sequence.load(std::memory_order_acquire);
+      const std::ptrdiff_t diff =
+          static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos);
+      if (diff == 0) {
+        if (enqueue_pos_.compare_exchange_weak(pos, pos + 1,
+                                               std::memory_order_relaxed))
+          break;
+      } else if (diff < 0) {
+        return false;
+      } else {
+        pos = enqueue_pos_.load(std::memory_order_relaxed);
+      }
+    }
+    new (cell->storage) value_type(std::forward<Args>(args)...);
+    cell->sequence.store(pos + 1, std::memory_order_release);
+    return true;
+  }
+
+  const size_type capacity_;
+  const size_type mask_;
+  Cell *const cells_;
+  alignas(kCacheLineSize) std::atomic<size_type> enqueue_pos_{0};
+  // Выравнивание поля дополняет объект до целой строки, так что
+  // dequeue_pos_ не делит её с соседями.
+  alignas(kCacheLineSize) std::atomic<size_type> dequeue_pos_{0};
+};
+}  // namespace s21
+
+#endif  // CONTAINERS_SRC_S21_MPMC_QUEUE_H_
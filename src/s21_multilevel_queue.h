@@ -0,0 +1,172 @@
+#ifndef CONTAINERS_SRC_S21_MULTILEVEL_QUEUE_H_
+#define CONTAINERS_SRC_S21_MULTILEVEL_QUEUE_H_
+
+#include <cstddef>    // size_t
+#include <cstdint>    // uint64_t
+#include <stdexcept>  // out_of_range invalid_argument
+#include <utility>    // forward move
+
+#include "s21_queue.h"
+
+namespace s21 {
+// Очередь с Levels уровнями приоритета, 0 — самый высокий. Каждый уровень —
+// s21::queue, а битовая маска nonempty_ отмечает непустые уровни, так что
+// нужный уровень находится одной инструкцией поиска младшего бита, а не
+// обходом всех очередей.
+//
+// pop/front — строгий приоритет. pop_fair — взвешенная справедливая выборка:
+// за раунд уровень отдаёт не больше weight элементов, после чего уступает
+// следующим по приоритету. Раунд заканчивается, когда у всех непустых
+// уровней кончился кредит; кредиты восстанавливаются лениво по номеру
+// раунда, поэтому и смена раунда O(1).
+template <class T, std::size_t Levels = 8>
+class multilevel_queue {
+  static_assert(Levels > 0 && Levels <= 64,
+                "multilevel_queue supports 1..64 levels");
+
+ public:
+  using value_type = T;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using size_type = std::size_t;
+
+  // Счётчики для мониторинга одного уровня.
+  struct level_stats {
+    size_type depth = 0;
+    size_type max_depth = 0;
+    std::uint64_t pushed = 0;
+    std::uint64_t popped = 0;
+  };
+
+  static constexpr size_type levels() noexcept { return Levels; }
+
+  void push(size_type level, const_reference value) { emplace(level, value); }
+  void push(size_type level, value_type &&value) {
+    emplace(level, std::move(value));
+  }
+
+  template <typename... Args>
+  void emplace(size_type level, Args &&...args) {
+    checkLevel(level);
+    Level &target = levels_[level];
+    target.items.emplace(std::forward<Args>(args)...);
+    nonempty_ |= bit(level);
+    ++size_;
+    level_stats &stats = target.stats;
+    ++stats.pushed;
+    if (++stats.depth > stats.max_depth) stats.max_depth = stats.depth;
+  }
+
+  // Элемент самого приоритетного непустого уровня.
+  const_reference front() { return levels_[top_level()].items.front(); }
+  size_type top_level() const {
+    if (!nonempty_) throw std::out_of_range("multilevel_queue is empty");
+    return lowestBit(nonempty_);
+  }
+
+  void pop() {
+    const size_type level = top_level();
+    levels_[level].items.pop();
+    popped(level);
+  }
+  // То же с переносом элемента в out.
+  size_type pop(reference out) {
+    const size_type level = top_level();
+    levels_[level].items.pop_n(1, &out);
+    popped(level);
+    return level;
+  }
+
+  // Переносит в out следующий элемент по взвешенной справедливой очереди и
+  // возвращает его уровень.
+  size_type pop_fair(reference out) {
+    if (!nonempty_) throw std::out_of_range("multilevel_queue is empty");
+    std::uint64_t candidates = nonempty_ & ~exhausted_;
+    if (!candidates) {
+      exhausted_ = 0;
+      ++round_;
+      candidates = nonempty_;
+    }
+    const size_type level = lowestBit(candidates);
+    Level &source = levels_[level];
+    if (source.round != round_) {
+      source.round = round_;
+      source.credit = source.weight;
+    }
+    source.items.pop_n(1, &out);
+    popped(level);
+    if (--source.credit == 0) exhausted_ |= bit(level);
+    return level;
+  }
+
+  // Сколько элементов уровень отдаёт pop_fair за раунд. По умолчанию 1 —
+  // круговой обход непустых уровней.
+  void set_weight(size_type level, size_type weight) {
+    checkLevel(level);
+    if (weight == 0)
+      throw std::invalid_argument("multilevel_queue weight must be positive");
+    levels_[level].weight = weight;
+  }
+  size_type weight(size_type level) const {
+    checkLevel(level);
+    return levels_[level].weight;
+  }
+
+  bool empty() const noexcept { return size_ == 0; }
+  size_type size() const noexcept { return size_; }
+  size_type depth(size_type level) const { return stats(level).depth; }
+  const level_stats &stats(size_type level) const {
+    checkLevel(level);
+    return levels_[level].stats;
+  }
+
+ private:
+  struct Level {
+    queue<value_type> items;
+    level_stats stats;
+    size_type weight = 1;
+    size_type credit = 0;
+    std::uint64_t round = 0;
+  };
+
+  static std::uint64_t bit(size_type level) noexcept {
+    return std::uint64_t{1} << level;
+  }
+  // mask не равна нулю.
+  static size_type lowestBit(std::uint64_t mask) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<size_type>(__builtin_ctzll(mask));
+#else
+    // Младший бит умножением на последовательность де Брёйна.
+    static constexpr unsigned char kIndex[64] = {
+        0,  1,  2,  53, 3,  7,  54, 27, 4,  38, 41, 8,  34, 55, 48, 28,
+        62, 5,  39, 46, 44, 42, 22, 9,  24, 35, 59, 56, 49, 18, 29, 11,
+        63, 52, 6,  26, 37, 40, 33, 47, 61, 45, 43, 21, 23, 58, 17, 10,
+        51, 25, 36, 32, 60, 20, 57, 16, 50, 31, 19, 15, 30, 14, 13, 12};
+    return kIndex[((mask & (~mask + 1)) * 0x022fdd63cc95386dULL) >> 58];
+#endif
+  }
+
+  void checkLevel(size_type level) const {
+    if (level >= Levels)
+      throw std::out_of_range("multilevel_queue level out of range");
+  }
+
+  void popped(size_type level) noexcept {
+    Level &source = levels_[level];
+    if (source.items.empty()) nonempty_ &= ~bit(level);
+    --size_;
+    --source.stats.depth;
+    ++source.stats.popped;
+  }
+
+  Level levels_[Levels];
+  std::uint64_t nonempty_ = 0;
+  std::uint64_t exhausted_ = 0;
+  // Начинается с 1: нулевой round уровня значит «кредит ещё не выдан».
+  std::uint64_t round_ = 1;
+  size_type size_ = 0;
+};
+}  // namespace s21
+
+#endif  // CONTAINERS_SRC_S21_MULTILEVEL_QUEUE_H_
@@ -0,0 +1,151 @@
+#ifndef CONTAINERS_SRC_S21_NODE_POOL_H_
+#define CONTAINERS_SRC_S21_NODE_POOL_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <new>
+
+namespace S21 {
+// Пул узлов фиксированного размера. Память берётся блоками (slab) растущего
+// размера, освобождённые узлы складываются в интрузивный список свободных и
+// переиспользуются. Память блоков возвращается системе только целиком:
+// в release() или в деструкторе пула.
+//
+// Пул не потокобезопасен. Контейнеры, обменявшиеся узлами (splice, merge),
+// объединяют свои пулы через join() и после этого делят одну память.
+template <typename Node>
+class NodePool {
+ public:
+  using size_type = std::size_t;
+
+  static constexpr size_type kFirstSlabNodes = 16;
+  static constexpr size_type kMaxSlabNodes = 4096;
+
+  NodePool() = default;
+  // Первый блок на first_slab_nodes узлов, дальше блоки растут вдвое.
+  explicit NodePool(size_type first_slab_nodes) noexcept
+      : first_slab_nodes_(std::max<size_type>(first_slab_nodes, 1)),
+        next_slab_nodes_(first_slab_nodes_) {}
+  NodePool(const NodePool &) = delete;
+  NodePool &operator=(const NodePool &) = delete;
+  ~NodePool() { release(); }
+
+  // Возвращает неинициализированную память под один Node.
+  void *allocate() {
+    if (free_) {
+      FreeNode *node = free_;
+      free_ = node->next_;
+      return node;
+    }
+    if (cursor_ == end_) addSlab();
+    void *node = cursor_;
+    cursor_ += sizeof(Node);
+    return node;
+  }
+
+  // Принимает память узла, деструктор которого уже вызван.
+  void deallocate(void *node) noexcept {
+    free_ = new (node) FreeNode{free_};
+  }
+
+  // Освобождает все блоки разом. Живых узлов в пуле быть не должно.
+  void release() noexcept {
+    while (slabs_) {
+      Slab *next = slabs_->next_;
+      ::operator delete(slabs_, std::align_val_t(kAlign));
+      slabs_ = next;
+    }
+    free_ = nullptr;
+    cursor_ = end_ = nullptr;
+    next_slab_nodes_ = first_slab_nodes_;
+  }
+
+  size_type slab_count() const noexcept {
+    size_type count = 0;
+    for (Slab *s = slabs_; s; s = s->next_) ++count;
+    return count;
+  }
+
+  // Переводит ссылку на пул, уже влитый в другой, на итоговый пул.
+  static void resolve(std::shared_ptr<NodePool> &pool) noexcept {
+    while (pool && pool->forward_) pool = pool->forward_;
+  }
+
+  // После вызова a и b указывают на один пул, владеющий памятью обоих.
+  // Старый пул b остаётся пустым и перенаправляет на a тех, кто ещё на него
+  // ссылается.
+  static void join(std::shared_ptr<NodePool> &a, std::shared_ptr<NodePool> &b) {
+    resolve(a);
+    resolve(b);
+    if (a == b || !b) {
+      b = a;
+    } else if (!a) {
+      a = b;
+    } else {
+      a->adopt(*b);
+      b->forward_ = a;
+      b = a;
+    }
+  }
+
+ private:
+  struct FreeNode {
+    FreeNode *next_;
+  };
+  struct Slab {
+    Slab *next_;
+  };
+
+  static_assert(sizeof(Node) >= sizeof(FreeNode),
+                "node is too small for the free list");
+
+  static constexpr size_type kAlign = std::max(alignof(Node), alignof(Slab));
+  static constexpr size_type kHeader =
+      (sizeof(Slab) + alignof(Node) - 1) / alignof(Node) * alignof(Node);
+
+  void addSlab() {
+    size_type bytes = kHeader + next_slab_nodes_ * sizeof(Node);
+    Slab *slab = static_cast<Slab *>(
+        ::operator new(bytes, std::align_val_t(kAlign)));
+    slab->next_ = slabs_;
+    slabs_ = slab;
+    cursor_ = reinterpret_cast<unsigned char *>(slab) + kHeader;
+    end_ = reinterpret_cast<unsigned char *>(slab) + bytes;
+    next_slab_nodes_ = std::min(next_slab_nodes_ * 2, kMaxSlabNodes);
+  }
+
+  // Забирает блоки и свободные узлы другого пула. Недоиспользованный хвост
+  // текущего блока other превращается в свободные узлы.
+  void adopt(NodePool &other) noexcept {
+    for (; other.cursor_ != other.end_; other.cursor_ += sizeof(Node))
+      other.deallocate(other.cursor_);
+    if (!free_) {
+      free_ = other.free_;
+      other.free_ = nullptr;
+    }
+    while (other.free_) {
+      FreeNode *node = other.free_;
+      other.free_ = node->next_;
+      deallocate(node);
+    }
+    while (other.slabs_) {
+      Slab *slab = other.slabs_;
+      other.slabs_ = slab->next_;
+      slab->next_ = slabs_;
+      slabs_ = slab;
+    }
+    other.cursor_ = other.end_ = nullptr;
+  }
+
+  Slab *slabs_ = nullptr;
+  FreeNode *free_ = nullptr;
+  unsigned char *cursor_ = nullptr;
+  unsigned char *end_ = nullptr;
+  size_type first_slab_nodes_ = kFirstSlabNodes;
+  size_type next_slab_nodes_ = kFirstSlabNodes;
+  std::shared_ptr<NodePool> forward_;
+};
+}  // namespace S21
+
+#endif  // CONTAINERS_SRC_S21_NODE_POOL_H_
@@ -1,28 +1,39 @@
 #pragma once
-#include "s21_stack.h"
+#include <cstddef>
+#include <initializer_list>
+#include <stdexcept>
+#include <utility>
+
+#include "s21_adapter_detail.h"
+#include "s21_deque.h"
 namespace s21 {
-template <class T>
-class queue : public stack<T> {
+// Адаптер над последовательным контейнером с front, back, push_back,
+// pop_front, empty, size и swap: кроме s21::deque подойдут s21::ring_buffer
+// и S21::List. deque по умолчанию: рост блоками не переносит элементы.
+// reserve, shrink_to_fit и capacity доступны, если они есть у Container,
+// например у ring_buffer.
+template <class T, class Container = deque<T>>
+class queue {
   using value_type = T;
   using reference = T &;
   using cons_reference = const T &;
   using size_type = std::size_t;
 
  public:
-  queue() noexcept : stack<value_type>() {}
-  explicit queue(std::initializer_list<value_type> const &items) noexcept
-      : stack<value_type>(items) {}
-  queue(const queue &other) noexcept : stack<value_type>(other) {}
-  queue(queue &&other) noexcept : stack<value_type>(other) {}
-  ~queue() noexcept {}
-
-  queue operator=(queue &&s) noexcept {
-    this->size_ = s.size_;
-    delete[] this->data_;
-    this->data_ = s.data_;
-    s.size_ = 0;
-    s.data_ = nullptr;
+  using container_type = Container;
+
+  queue() = default;
+  explicit queue(std::initializer_list<value_type> const &items) {
+    for (const auto &item : items) container_.push_back(item);
   }
+  explicit queue(const Container &container) : container_(container) {}
+  explicit queue(Container &&container) : container_(std::move(container)) {}
+  queue(const queue &other) = default;
+  queue(queue &&other) = default;
+  ~queue() = default;
+
+  queue &operator=(const queue &s) = default;
+  queue &operator=(queue &&s) = default;
 
   bool operator==(const queue &other) = delete;
   bool operator!=(const queue &other) = delete;
@@ -32,19 +43,51 @@ class queue : public stack<T> {
   bool operator<=(const queue &other) = delete;
   reference operator[](size_type) = delete;
 
-  cons_reference back() noexcept { return this->data_[this->size_ - 1]; }
-  cons_reference front() noexcept { return this->data_[0]; }
-  cons_reference top() = delete;
+  cons_reference back() { return container_.back(); }
+  cons_reference front() { return container_.front(); }
+  bool empty() { return container_.empty(); }
+  size_type size() { return container_.size(); }
+  size_type capacity() const { return container_.capacity(); }
 
+  void push(cons_reference value) { container_.push_back(value); }
+  void push(value_type &&value) { container_.push_back(std::move(value)); }
+  template <typename... Args>
+  void emplace(Args &&...args) {
+    container_.emplace_back(std::forward<Args>(args)...);
+  }
+  // Место под все элементы резервируется один раз.
+  template <typename InputIt>
+  void push_range(InputIt first, InputIt last) {
+    adapter_detail::reserveRange(container_, first, last);
+    for (; first != last; ++first) container_.push_back(*first);
+  }
+  template <typename... Args>
+  void insert_many_back(Args &&...args) {
+    adapter_detail::reserveMore(container_, sizeof...(Args));
+    (container_.push_back(std::forward<Args>(args)), ...);
+  }
   void pop() {
-    if (this->size_ == 0) {
-      throw std::out_of_range("stack is empty");
+    if (container_.empty()) {
+      throw std::out_of_range("queue is empty");
+    }
+    container_.pop_front();
+  }
+  // Переносит в out до n элементов начиная с первого, возвращает сколько
+  // перенесено.
+  template <typename OutputIt>
+  size_type pop_n(size_type n, OutputIt out) {
+    size_type count = 0;
+    for (; count < n && !container_.empty(); ++count, ++out) {
+      *out = std::move(container_.front());
+      container_.pop_front();
     }
-    this->size_--;
-    value_type *buff = new value_type[this->size_];
-    for (size_t i = 1; i < this->size_ + 1; i++) buff[i - 1] = this->data_[i];
-    delete[] this->data_;
-    this->data_ = buff;
+    return count;
   }
+  void reserve(size_type capacity) { container_.reserve(capacity); }
+  void shrink_to_fit() { container_.shrink_to_fit(); }
+  void swap(queue &other) noexcept { container_.swap(other.container_); }
+
+ protected:
+  Container container_;
 };
-}  // namespace s21
\ No newline at end of file
+}  // namespace s21
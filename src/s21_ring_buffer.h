@@ -0,0 +1,204 @@
+#ifndef CONTAINERS_SRC_S21_RING_BUFFER_H_
+#define CONTAINERS_SRC_S21_RING_BUFFER_H_
+
+#include <algorithm>         // max
+#include <cstddef>           // size_t
+#include <initializer_list>  // initializer_list
+#include <memory>            // allocator
+#include <new>               // placement new
+#include <utility>           // forward move swap
+
+namespace s21 {
+// Растущий кольцевой буфер: добавление в конец и удаление с обоих концов за
+// O(1) амортизированно. i-й элемент лежит в слоте (head_ + i) & (capacity_ -
+// 1), вместимость — степень двойки. Буфер растёт вдвое, а уменьшается вдвое,
+// только когда занято меньше четверти, поэтому push и pop на границе не
+// вызывают перевыделений. Подходит хранилищем s21::stack и s21::queue,
+// когда нужны reserve и capacity, которых нет у s21::deque.
+template <class T>
+class ring_buffer {
+ public:
+  using value_type = T;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using size_type = std::size_t;
+
+  static constexpr size_type kMinCapacity = 8;
+
+  ring_buffer() noexcept
+      : data_(nullptr), capacity_(0), head_(0), size_(0) {}
+  ring_buffer(std::initializer_list<value_type> const &items)
+      : ring_buffer() {
+    reserve(items.size());
+    for (const_reference item : items) push_back(item);
+  }
+  ring_buffer(const ring_buffer &other) : ring_buffer() {
+    reserve(other.size_);
+    for (size_type i = 0; i < other.size_; ++i) push_back(other[i]);
+  }
+  ring_buffer(ring_buffer &&other) noexcept : ring_buffer() { swap(other); }
+  ~ring_buffer() {
+    clear();
+    deallocate(data_, capacity_);
+  }
+
+  ring_buffer &operator=(const ring_buffer &other) {
+    if (this != &other) {
+      ring_buffer tmp(other);
+      swap(tmp);
+    }
+    return *this;
+  }
+  ring_buffer &operator=(ring_buffer &&other) noexcept {
+    if (this != &other) {
+      ring_buffer tmp(std::move(other));
+      swap(tmp);
+    }
+    return *this;
+  }
+
+  reference operator[](size_type pos) noexcept { return *slot(pos); }
+  const_reference operator[](size_type pos) const noexcept {
+    return *slot(pos);
+  }
+  reference front() noexcept { return *slot(0); }
+  const_reference front() const noexcept { return *slot(0); }
+  reference back() noexcept { return *slot(size_ - 1); }
+  const_reference back() const noexcept { return *slot(size_ - 1); }
+
+  bool empty() const noexcept { return size_ == 0; }
+  size_type size() const noexcept { return size_; }
+  size_type capacity() const noexcept { return capacity_; }
+
+  void push_back(const_reference value) { emplace_back(value); }
+  void push_back(value_type &&value) { emplace_back(std::move(value)); }
+
+  template <typename... Args>
+  reference emplace_back(Args &&...args) {
+    if (size_ == capacity_) {
+      // Новый элемент создаётся до переноса старых: аргументы могут ссылаться
+      // на элементы самого буфера.
+      size_type capacity = std::max(kMinCapacity, capacity_ * 2);
+      value_type *data = allocate(capacity);
+      try {
+        new (data + size_) value_type(std::forward<Args>(args)...);
+      } catch (...) {
+        deallocate(data, capacity);
+        throw;
+      }
+      try {
+        moveTo(data);
+      } catch (...) {
+        data[size_].~value_type();
+        deallocate(data, capacity);
+        throw;
+      }
+      adopt(data, capacity);
+    } else {
+      new (slot(size_)) value_type(std::forward<Args>(args)...);
+    }
+    ++size_;
+    return back();
+  }
+
+  void pop_back() noexcept {
+    slot(size_ - 1)->~value_type();
+    --size_;
+    shrinkIfSparse();
+  }
+  void pop_front() noexcept {
+    slot(0)->~value_type();
+    head_ = (head_ + 1) & (capacity_ - 1);
+    --size_;
+    shrinkIfSparse();
+  }
+
+  void clear() noexcept {
+    for (size_type i = 0; i < size_; ++i) slot(i)->~value_type();
+    head_ = size_ = 0;
+  }
+
+  void reserve(size_type capacity) {
+    if (capacity > capacity_) reallocate(roundUp(capacity));
+  }
+  void shrink_to_fit() {
+    size_type capacity = size_ ? roundUp(size_) : 0;
+    if (capacity < capacity_) reallocate(capacity);
+  }
+
+  void swap(ring_buffer &other) noexcept {
+    std::swap(data_, other.data_);
+    std::swap(capacity_, other.capacity_);
+    std::swap(head_, other.head_);
+    std::swap(size_, other.size_);
+  }
+
+ private:
+  value_type *slot(size_type pos) const noexcept {
+    return data_ + ((head_ + pos) & (capacity_ - 1));
+  }
+
+  static size_type roundUp(size_type n) noexcept {
+    size_type capacity = 1;
+    while (capacity < n) capacity *= 2;
+    return capacity;
+  }
+
+  static value_type *allocate(size_type n) {
+    return n ? std::allocator<value_type>().allocate(n) : nullptr;
+  }
+  static void deallocate(value_type *data, size_type n) noexcept {
+    if (data) std::allocator<value_type>().deallocate(data, n);
+  }
+
+  // Переносит элементы в data по порядку с нулевого слота. При исключении
+  // копии уничтожаются, а сам буфер не меняется.
+  void moveTo(value_type *data) {
+    size_type i = 0;
+    try {
+      for (; i < size_; ++i)
+        new (data + i) value_type(std::move_if_noexcept(*slot(i)));
+    } catch (...) {
+      while (i) data[--i].~value_type();
+      throw;
+    }
+  }
+
+  // Заменяет хранилище на data, куда элементы уже перенесены.
+  void adopt(value_type *data, size_type capacity) noexcept {
+    for (size_type i = 0; i < size_; ++i) slot(i)->~value_type();
+    deallocate(data_, capacity_);
+    data_ = data;
+    capacity_ = capacity;
+    head_ = 0;
+  }
+
+  void reallocate(size_type capacity) {
+    value_type *data = allocate(capacity);
+    try {
+      moveTo(data);
+    } catch (...) {
+      deallocate(data, capacity);
+      throw;
+    }
+    adopt(data, capacity);
+  }
+
+  void shrinkIfSparse() noexcept {
+    if (capacity_ > kMinCapacity && size_ < capacity_ / 4) {
+      try {
+        reallocate(capacity_ / 2);
+      } catch (...) {
+        // уменьшение необязательно, буфер остаётся прежней вместимости
+      }
+    }
+  }
+
+  value_type *data_;
+  size_type capacity_;
+  size_type head_;
+  size_type size_;
+};
+}  // namespace s21
+
+#endif  // CONTAINERS_SRC_S21_RING_BUFFER_H_
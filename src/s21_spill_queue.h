@@ -0,0 +1,269 @@
+#ifndef CONTAINERS_SRC_S21_SPILL_QUEUE_H_
+#define CONTAINERS_SRC_S21_SPILL_QUEUE_H_
+
+#include <unistd.h>  // getpid
+
+#include <algorithm>    // min max
+#include <atomic>       // atomic
+#include <cstddef>      // size_t
+#include <cstdio>       // FILE fopen fread fseek fwrite remove
+#include <stdexcept>    // out_of_range runtime_error
+#include <string>       // string to_string
+#include <type_traits>  // is_trivially_copyable_v
+#include <utility>      // move
+
+#include "s21_deque.h"
+#include "s21_vector.h"
+
+namespace s21 {
+namespace spill_detail {
+// pid и номер очереди в процессе: две очереди в одном каталоге, из этого
+// процесса или из соседнего, не пишут в один файл.
+inline std::string uniquePrefix() {
+  static std::atomic<unsigned long long> next{0};
+  return std::to_string(getpid()) + "_" + std::to_string(next.fetch_add(1));
+}
+}  // namespace spill_detail
+
+// Очередь, которая при всплеске нагрузки уходит на диск, а не в память.
+// Порядок элементов: head_ (в памяти) -> сегменты на диске -> tail_ (в
+// памяти). Пока диск не задействован, push кладёт прямо в head_. Когда
+// head_ заполнен, новые элементы копятся в tail_ и пачками дописываются в
+// файлы-сегменты в каталоге directory; файл только дописывается и удаляется
+// целиком, когда прочитан.
+//
+// pop читает сегменты последовательно и с упреждением: как только в head_
+// остаётся меньше половины, он дочитывается большими кусками. Так в памяти
+// всегда не больше memory_items элементов в head_ и по memory_items / 2 в
+// tail_ и в буфере чтения, сколько бы ни лежало на диске.
+//
+// Элементы пишутся побайтно, поэтому T должен копироваться тривиально и не
+// содержать указателей на другую память.
+//
+// Если push бросил исключение (сегмент не открылся или не записался),
+// очередь осталась такой, как до вызова, и push можно повторить. Сегмент,
+// запись в который не удалась, больше не дописывается. Если не удалось
+// прочитать сегмент, front и pop бросают, а очередь не меняется: следующий
+// вызов перечитает тот же участок. Упреждающее чтение после уже снятого
+// элемента pop не бросает, ошибка проявится в следующем front или pop.
+template <class T>
+class spill_queue {
+  static_assert(std::is_trivially_copyable_v<T>,
+                "spill_queue requires trivially copyable T");
+
+ public:
+  using value_type = T;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using size_type = std::size_t;
+
+  static constexpr size_type kDefaultMemoryItems = size_type{1} << 16;
+  static constexpr size_type kDefaultSegmentItems = size_type{1} << 20;
+
+  explicit spill_queue(std::string directory,
+                       size_type memory_items = kDefaultMemoryItems,
+                       size_type segment_items = kDefaultSegmentItems)
+      : directory_(std::move(directory)),
+        memory_items_(std::max<size_type>(memory_items, 2)),
+        batch_items_(memory_items_ / 2),
+        segment_items_(std::max(segment_items, batch_items_)),
+        prefix_(spill_detail::uniquePrefix()),
+        chunk_(batch_items_) {
+    tail_.reserve(batch_items_);
+  }
+
+  spill_queue(const spill_queue &) = delete;
+  spill_queue &operator=(const spill_queue &) = delete;
+
+  ~spill_queue() {
+    if (writer_) std::fclose(writer_);
+    if (reader_) std::fclose(reader_);
+    for (const Segment &segment : segments_) std::remove(segment.path.c_str());
+  }
+
+  const_reference front() {
+    checkNotEmpty();
+    if (head_.empty()) refill();
+    return head_.front();
+  }
+
+  bool empty() const noexcept { return size_ == 0; }
+  size_type size() const noexcept { return size_; }
+  // Сколько элементов сейчас лежит на диске.
+  size_type spilled() const noexcept {
+    return size_ - head_.size() - tail_.size();
+  }
+
+  void push(const_reference value) {
+    if (segments_.empty() && tail_.size() == 0 &&
+        head_.size() < memory_items_) {
+      head_.push_back(value);
+      ++size_;
+    } else {
+      tail_.push_back(value);
+      ++size_;
+      if (tail_.size() >= batch_items_) {
+        try {
+          flushTail();
+        } catch (...) {
+          // Новый элемент последний в tail_ и на диск не попал.
+          tail_.pop_back();
+          --size_;
+          throw;
+        }
+      }
+    }
+  }
+
+  void pop() {
+    checkNotEmpty();
+    if (head_.empty()) refill();
+    head_.pop_front();
+    --size_;
+    if (head_.size() < memory_items_ / 2 && size_ > head_.size()) {
+      try {
+        refill();
+      } catch (...) {
+        // Элемент уже снят, а head_ не пуст или очередь кончилась.
+      }
+    }
+  }
+
+ private:
+  struct Segment {
+    std::string path;
+    size_type count = 0;
+  };
+
+  void checkNotEmpty() const {
+    if (size_ == 0) throw std::out_of_range("spill_queue is empty");
+  }
+
+  std::string nextPath() {
+    return directory_ + "/s21_spill_" + prefix_ + "_" +
+           std::to_string(next_segment_++) + ".seg";
+  }
+
+  static std::FILE *open(const std::string &path, const char *mode) {
+    std::FILE *file = std::fopen(path.c_str(), mode);
+    if (!file) throw std::runtime_error("spill_queue: cannot open " + path);
+    return file;
+  }
+
+  // Дописывает tail_ в сегменты, открывая новый, когда текущий полон.
+  // segment.count учитывает только то, что дошло до файла: каждая порция
+  // сбрасывается fflush. При ошибке сколько байт порции записано,
+  // неизвестно, поэтому сегмент закрывается, а из tail_ убираются только
+  // элементы, уже записанные целиком.
+  void flushTail() {
+    size_type written = 0;
+    while (written < tail_.size()) {
+      if (!writer_) {
+        try {
+          openSegment();
+        } catch (...) {
+          dropWritten(written);
+          throw;
+        }
+      }
+      Segment &segment = segments_.back();
+      const size_type n =
+          std::min(tail_.size() - written, segment_items_ - segment.count);
+      if (std::fwrite(tail_.data() + written, sizeof(value_type), n,
+                      writer_) != n ||
+          std::fflush(writer_) != 0) {
+        closeWriter();
+        dropWritten(written);
+        throw std::runtime_error("spill_queue: cannot write " + segment.path);
+      }
+      segment.count += n;
+      written += n;
+      if (segment.count == segment_items_) closeWriter();
+    }
+    tail_.clear();
+  }
+
+  void openSegment() {
+    segments_.push_back(Segment{nextPath(), 0});
+    try {
+      writer_ = open(segments_.back().path, "wb");
+    } catch (...) {
+      segments_.pop_back();
+      throw;
+    }
+  }
+
+  // Данные уже сброшены fflush, поэтому ошибка fclose их не теряет.
+  void closeWriter() noexcept {
+    std::fclose(writer_);
+    writer_ = nullptr;
+  }
+
+  // Убирает из начала tail_ count элементов, уже лежащих на диске.
+  void dropWritten(size_type count) noexcept {
+    if (count == 0) return;
+    const size_type left = tail_.size() - count;
+    for (size_type i = 0; i < left; ++i) tail_[i] = tail_[i + count];
+    for (size_type i = 0; i < count; ++i) tail_.pop_back();
+  }
+
+  // Дочитывает head_ до memory_items_: сначала из сегментов по порядку,
+  // затем из tail_, если тот помещается целиком.
+  void refill() {
+    size_type room = memory_items_ - head_.size();
+    while (room > 0 && !segments_.empty()) {
+      Segment &segment = segments_.front();
+      // Читатель догнал писателя: текущий сегмент закрывается как есть.
+      if (writer_ && segments_.size() == 1) closeWriter();
+      if (!reader_) {
+        reader_ = open(segment.path, "rb");
+        consumed_ = 0;
+      }
+      const size_type n =
+          std::min({room, segment.count - consumed_, chunk_.size()});
+      const size_type before = head_.size();
+      try {
+        if (std::fread(chunk_.data(), sizeof(value_type), n, reader_) != n)
+          throw std::runtime_error("spill_queue: cannot read " + segment.path);
+        for (size_type i = 0; i < n; ++i) head_.push_back(chunk_[i]);
+      } catch (...) {
+        // Кусок не засчитан: читатель возвращается к consumed_.
+        while (head_.size() > before) head_.pop_back();
+        std::clearerr(reader_);
+        std::fseek(reader_, static_cast<long>(consumed_ * sizeof(value_type)),
+                   SEEK_SET);
+        throw;
+      }
+      consumed_ += n;
+      room -= n;
+      if (consumed_ == segment.count) {
+        std::fclose(reader_);
+        reader_ = nullptr;
+        std::remove(segment.path.c_str());
+        segments_.pop_front();
+      }
+    }
+    if (segments_.empty() && tail_.size() > 0 && tail_.size() <= room) {
+      for (size_type i = 0; i < tail_.size(); ++i) head_.push_back(tail_[i]);
+      tail_.clear();
+    }
+  }
+
+  const std::string directory_;
+  const size_type memory_items_;
+  const size_type batch_items_;
+  const size_type segment_items_;
+  const std::string prefix_;
+  deque<value_type> head_;
+  Vector<value_type> tail_;
+  Vector<value_type> chunk_;
+  deque<Segment> segments_;
+  std::FILE *writer_ = nullptr;
+  std::FILE *reader_ = nullptr;
+  size_type consumed_ = 0;
+  size_type next_segment_ = 0;
+  size_type size_ = 0;
+};
+}  // namespace s21
+
+#endif  // CONTAINERS_SRC_S21_SPILL_QUEUE_H_
@@ -0,0 +1,46 @@
+#ifndef CONTAINERS_SRC_S21_SPIN_WAIT_H_
+#define CONTAINERS_SRC_S21_SPIN_WAIT_H_
+
+#include <cstddef>  // size_t
+#include <thread>   // yield
+
+namespace s21 {
+// Размер строки кэша для разнесения горячих полей. Фиксирован, а не взят из
+// std::hardware_destructive_interference_size, чтобы раскладка объектов не
+// зависела от флагов компилятора.
+constexpr std::size_t kCacheLineSize = 64;
+
+// Ожидание в цикле с нарастающей паузой: сначала короткие серии pause, затем
+// уступка процессора через std::this_thread::yield. Общая часть для
+// неблокирующих контейнеров.
+class spin_wait {
+ public:
+  static constexpr unsigned kSpinLimit = 6;
+
+  void wait() noexcept {
+    if (step_ < kSpinLimit) {
+      for (unsigned i = 0; i < (1u << step_); ++i) relax();
+      ++step_;
+    } else {
+      std::this_thread::yield();
+    }
+  }
+
+  void reset() noexcept { step_ = 0; }
+  // Ещё не дошло до уступки процессора.
+  bool spinning() const noexcept { return step_ < kSpinLimit; }
+
+  static void relax() noexcept {
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__)
+    asm volatile("yield");
+#endif
+  }
+
+ private:
+  unsigned step_ = 0;
+};
+}  // namespace s21
+
+#endif  // CONTAINERS_SRC_S21_SPIN_WAIT_H_
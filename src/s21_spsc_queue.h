@@ -0,0 +1,177 @@
+#ifndef CONTAINERS_SRC_S21_SPSC_QUEUE_H_
+#define CONTAINERS_SRC_S21_SPSC_QUEUE_H_
+
+#include <algorithm>  // min
+#include <atomic>     // atomic memory_order
+#include <cstddef>    // size_t
+#include <memory>     // allocator
+#include <new>        // placement new
+#include <utility>    // forward move
+
+#include "s21_spin_wait.h"
+
+namespace s21 {
+// Неблокирующая очередь для ровно одного производителя и одного потребителя.
+// Ёмкость фиксирована и округляется вверх до степени двойки. Индексы tail_ и
+// head_ только растут, слот — индекс по маске, так что заняты могут быть все
+// слоты. Производитель публикует элементы записью tail_ с release,
+// потребитель освобождает слоты записью head_ с release.
+//
+// Поля каждой стороны лежат на своей строке кэша вместе с копией чужого
+// индекса: чужая строка читается, только когда по копии очередь выглядит
+// полной (или пустой).
+template <class T>
+class spsc_queue {
+ public:
+  using value_type = T;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using size_type = std::size_t;
+
+  explicit spsc_queue(size_type capacity)
+      : capacity_(roundUp(capacity)),
+        mask_(capacity_ - 1),
+        slots_(std::allocator<value_type>().allocate(capacity_)) {}
+
+  spsc_queue(const spsc_queue &) = delete;
+  spsc_queue &operator=(const spsc_queue &) = delete;
+
+  ~spsc_queue() {
+    size_type head = consumer_.head.load(std::memory_order_relaxed);
+    const size_type tail = producer_.tail.load(std::memory_order_relaxed);
+    for (; head != tail; ++head) slot(head)->~value_type();
+    std::allocator<value_type>().deallocate(slots_, capacity_);
+  }
+
+  // Только для производителя.
+  bool try_push(const_reference value) { return try_emplace(value); }
+  bool try_push(value_type &&value) { return try_emplace(std::move(value)); }
+
+  template <typename... Args>
+  bool try_emplace(Args &&...args) {
+    const size_type tail = producer_.tail.load(std::memory_order_relaxed);
+    if (tail - producer_.cached_head == capacity_) {
+      producer_.cached_head = consumer_.head.load(std::memory_order_acquire);
+      if (tail - producer_.cached_head == capacity_) return false;
+    }
+    new (slot(tail)) value_type(std::forward<Args>(args)...);
+    producer_.tail.store(tail + 1, std::memory_order_release);
+    return true;
+  }
+
+  // Ждёт свободного слота.
+  void push(const_reference value) {
+    spin_wait waiter;
+    while (!try_push(value)) waiter.wait();
+  }
+  void push(value_type &&value) {
+    spin_wait waiter;
+    while (!try_push(std::move(value))) waiter.wait();
+  }
+
+  // Кладёт до n элементов из first одной публикацией, возвращает сколько
+  // поместилось.
+  template <typename InputIt>
+  size_type push_n(InputIt first, size_type n) {
+    const size_type tail = producer_.tail.load(std::memory_order_relaxed);
+    size_type free = capacity_ - (tail - producer_.cached_head);
+    if (free < n) {
+      producer_.cached_head = consumer_.head.load(std::memory_order_acquire);
+      free = capacity_ - (tail - producer_.cached_head);
+    }
+    const size_type count = std::min(n, free);
+    size_type i = 0;
+    try {
+      for (; i < count; ++i, ++first) new (slot(tail + i)) value_type(*first);
+    } catch (...) {
+      producer_.tail.store(tail + i, std::memory_order_release);
+      throw;
+    }
+    producer_.tail.store(tail + count, std::memory_order_release);
+    return count;
+  }
+
+  // Только для потребителя.
+  bool try_pop(reference out) {
+    const size_type head = consumer_.head.load(std::memory_order_relaxed);
+    if (head == consumer_.cached_tail) {
+      consumer_.cached_tail = producer_.tail.load(std::memory_order_acquire);
+      if (head == consumer_.cached_tail) return false;
+    }
+    value_type *item = slot(head);
+    out = std::move(*item);
+    item->~value_type();
+    consumer_.head.store(head + 1, std::memory_order_release);
+    return true;
+  }
+
+  // Ждёт элемента.
+  void pop(reference out) {
+    spin_wait waiter;
+    while (!try_pop(out)) waiter.wait();
+  }
+
+  // Забирает до n элементов в out одной публикацией, возвращает сколько
+  // забрано.
+  template <typename OutputIt>
+  size_type pop_n(OutputIt out, size_type n) {
+    const size_type head = consumer_.head.load(std::memory_order_relaxed);
+    size_type ready = consumer_.cached_tail - head;
+    if (ready < n) {
+      consumer_.cached_tail = producer_.tail.load(std::memory_order_acquire);
+      ready = consumer_.cached_tail - head;
+    }
+    const size_type count = std::min(n, ready);
+    size_type i = 0;
+    try {
+      for (; i < count; ++i, ++out) {
+        value_type *item = slot(head + i);
+        *out = std::move(*item);
+        item->~value_type();
+      }
+    } catch (...) {
+      consumer_.head.store(head + i, std::memory_order_release);
+      throw;
+    }
+    consumer_.head.store(head + count, std::memory_order_release);
+    return count;
+  }
+
+  // Из других потоков значения приблизительные.
+  bool empty() const noexcept { return size() == 0; }
+  size_type size() const noexcept {
+    const size_type head = consumer_.head.load(std::memory_order_acquire);
+    const size_type tail = producer_.tail.load(std::memory_order_acquire);
+    return tail - head <= capacity_ ? tail - head : 0;
+  }
+  size_type capacity() const noexcept { return capacity_; }
+
+ private:
+  struct alignas(kCacheLineSize) ProducerSide {
+    std::atomic<size_type> tail{0};
+    size_type cached_head = 0;
+  };
+  struct alignas(kCacheLineSize) ConsumerSide {
+    std::atomic<size_type> head{0};
+    size_type cached_tail = 0;
+  };
+
+  static size_type roundUp(size_type n) noexcept {
+    size_type capacity = 2;
+    while (capacity < n) capacity *= 2;
+    return capacity;
+  }
+
+  value_type *slot(size_type index) const noexcept {
+    return slots_ + (index & mask_);
+  }
+
+  const size_type capacity_;
+  const size_type mask_;
+  value_type *const slots_;
+  ProducerSide producer_;
+  ConsumerSide consumer_;
+};
+}  // namespace s21
+
+#endif  // CONTAINERS_SRC_S21_SPSC_QUEUE_H_
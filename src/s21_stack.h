@@ -1,7 +1,18 @@
 #pragma once
-#include <cassert>
+#include <cstddef>
+#include <initializer_list>
+#include <stdexcept>
+#include <utility>
+
+#include "s21_adapter_detail.h"
+#include "s21_vector.h"
 namespace s21 {
-template <class T>
+// Адаптер над последовательным контейнером с back, push_back, pop_back,
+// empty, size и swap: кроме s21::Vector подойдут s21::ring_buffer,
+// s21::deque и S21::List. Vector по умолчанию: стеку нужен только конец,
+// и непрерывный буфер без маски индекса здесь быстрее всех.
+// reserve, shrink_to_fit и capacity доступны, если они есть у Container.
+template <class T, class Container = Vector<T>>
 class stack {
   using value_type = T;
   using reference = T &;
@@ -9,41 +20,20 @@ class stack {
   using size_type = std::size_t;
 
  public:
-  stack() noexcept : size_(0), data_(nullptr) {}
-  explicit stack(std::initializer_list<value_type> const &items) noexcept {
-    size_ = items.size();
-    if (data_ != nullptr) delete[] data_;
-    data_ = new value_type[size_];
-    for (size_t i = 0; i < size_; i++) {
-      data_[i] = *(items.begin() + i);
-    }
-  }
-  stack(const stack &other) noexcept {
-    size_ = other.size_;
-    if (data_ != nullptr) delete[] data_;
-    data_ = new value_type[size_];
-    for (size_t i = 0; i < size_; i++) {
-      data_[i] = other.data_[i];
-    }
-  }
-  stack(stack &&other) noexcept {
-    size_ = other.size_;
-    if (data_ != nullptr) delete[] data_;
-    data_ = other.data_;
-    other.size_ = 0;
-    other.data_ = nullptr;
-  }
-  ~stack() noexcept {
-    if (data_ != nullptr) delete[] data_;
-  }
+  using container_type = Container;
 
-  stack operator=(stack &&s) noexcept {
-    size_ = s.size_;
-    delete[] data_;
-    data_ = s.data_;
-    s.size_ = 0;
-    s.data_ = nullptr;
+  stack() = default;
+  explicit stack(std::initializer_list<value_type> const &items) {
+    for (const auto &item : items) container_.push_back(item);
   }
+  explicit stack(const Container &container) : container_(container) {}
+  explicit stack(Container &&container) : container_(std::move(container)) {}
+  stack(const stack &other) = default;
+  stack(stack &&other) = default;
+  ~stack() = default;
+
+  stack &operator=(const stack &s) = default;
+  stack &operator=(stack &&s) = default;
 
   bool operator==(const stack &other) = delete;
   bool operator!=(const stack &other) = delete;
@@ -53,43 +43,50 @@ class stack {
   bool operator<=(const stack &other) = delete;
   reference operator[](size_type) = delete;
 
-  cons_reference top() noexcept { return data_[size_ - 1]; }
-  bool empty() noexcept { return size_ == 0; }
-  size_type size() noexcept { return size_; }
-  void push(cons_reference value) {
-    size_++;
-    value_type *buff;
-    try {
-      buff = new value_type[size_];
-    } catch (...) {
-      throw std::bad_alloc();
-    }
-    for (size_t i = 0; i < size_ - 1; i++) buff[i] = data_[i];
-    buff[size_ - 1] = value;
-    delete[] data_;
-    data_ = buff;
+  cons_reference top() { return container_.back(); }
+  bool empty() { return container_.empty(); }
+  size_type size() { return container_.size(); }
+  size_type capacity() const { return container_.capacity(); }
+
+  void push(cons_reference value) { container_.push_back(value); }
+  void push(value_type &&value) { container_.push_back(std::move(value)); }
+  template <typename... Args>
+  void emplace(Args &&...args) {
+    container_.emplace_back(std::forward<Args>(args)...);
+  }
+  // Место под все элементы резервируется один раз.
+  template <typename InputIt>
+  void push_range(InputIt first, InputIt last) {
+    adapter_detail::reserveRange(container_, first, last);
+    for (; first != last; ++first) container_.push_back(*first);
+  }
+  template <typename... Args>
+  void insert_many_back(Args &&...args) {
+    adapter_detail::reserveMore(container_, sizeof...(Args));
+    (container_.push_back(std::forward<Args>(args)), ...);
   }
   void pop() {
-    if (size_ == 0) {
+    if (container_.empty()) {
       throw std::out_of_range("stack is empty");
     }
-    size_--;
-    value_type *buff = new value_type[size_];
-    for (size_t i = 0; i < size_; i++) buff[i] = data_[i];
-    delete[] data_;
-    data_ = buff;
+    container_.pop_back();
   }
-  void swap(stack &other) noexcept {
-    size_type sbuff = other.size_;
-    value_type *pbuff = other.data_;
-    other.size_ = size_;
-    other.data_ = data_;
-    size_ = sbuff;
-    data_ = pbuff;
+  // Переносит в out до n элементов начиная с вершины, возвращает сколько
+  // перенесено.
+  template <typename OutputIt>
+  size_type pop_n(size_type n, OutputIt out) {
+    size_type count = 0;
+    for (; count < n && !container_.empty(); ++count, ++out) {
+      *out = std::move(container_.back());
+      container_.pop_back();
+    }
+    return count;
   }
+  void reserve(size_type capacity) { container_.reserve(capacity); }
+  void shrink_to_fit() { container_.shrink_to_fit(); }
+  void swap(stack &other) noexcept { container_.swap(other.container_); }
 
  protected:
-  size_type size_;
-  value_type *data_ = nullptr;
+  Container container_;
 };
-}  // namespace s21
\ No newline at end of file
+}  // namespace s21
@@ -0,0 +1,204 @@
+#ifndef CONTAINERS_SRC_S21_STATIC_VECTOR_H_
+#define CONTAINERS_SRC_S21_STATIC_VECTOR_H_
+
+#include <algorithm>         // move rotate
+#include <cstddef>           // size_t
+#include <initializer_list>  // initializer_list
+#include <new>               // placement new, launder
+#include <stdexcept>         // out_of_range length_error
+#include <type_traits>       // is_nothrow_move_constructible_v
+#include <utility>           // forward move
+
+namespace s21 {
+// Вектор с фиксированной ёмкостью N. Элементы лежат прямо внутри объекта,
+// куча не используется; попытка превысить ёмкость бросает length_error.
+template <class T, std::size_t N>
+class static_vector {
+ public:
+  using value_type = T;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using iterator = value_type *;
+  using const_iterator = const value_type *;
+  using size_type = std::size_t;
+
+  static_vector() noexcept : size_(0) {}
+  explicit static_vector(size_type n) : size_(0) {
+    checkCapacity(n);
+    constructAll(n, [](void *at, size_type) { new (at) value_type(); });
+  }
+  static_vector(std::initializer_list<value_type> const &items) : size_(0) {
+    checkCapacity(items.size());
+    constructAll(items.size(), [&items](void *at, size_type i) {
+      new (at) value_type(items.begin()[i]);
+    });
+  }
+  static_vector(const static_vector &v) : size_(0) {
+    constructAll(v.size_, [&v](void *at, size_type i) {
+      new (at) value_type(v[i]);
+    });
+  }
+  // noexcept, когда T переносится без исключений: тогда std::vector и
+  // s21::Vector при росте переносят, а не копируют.
+  static_vector(static_vector &&v) noexcept(
+      std::is_nothrow_move_constructible_v<T>)
+      : size_(0) {
+    constructAll(v.size_, [&v](void *at, size_type i) {
+      new (at) value_type(std::move(v[i]));
+    });
+    v.clear();
+  }
+  ~static_vector() noexcept { clear(); }
+
+  static_vector &operator=(const static_vector &v) {
+    if (this != &v) {
+      clear();
+      for (; size_ < v.size_; ++size_) new (slot(size_)) value_type(v[size_]);
+    }
+    return *this;
+  }
+  static_vector &operator=(static_vector &&v) noexcept(
+      std::is_nothrow_move_constructible_v<T>) {
+    if (this != &v) {
+      clear();
+      for (; size_ < v.size_; ++size_)
+        new (slot(size_)) value_type(std::move(v[size_]));
+      v.clear();
+    }
+    return *this;
+  }
+
+  reference at(size_type pos) {
+    if (pos >= size_) {
+      throw std::out_of_range("Index out of range");
+    }
+    return data()[pos];
+  }
+  const_reference at(size_type pos) const {
+    if (pos >= size_) {
+      throw std::out_of_range("Index out of range");
+    }
+    return data()[pos];
+  }
+  reference operator[](size_type pos) { return data()[pos]; }
+  const_reference operator[](size_type pos) const { return data()[pos]; }
+  const_reference front() const {
+    if (size_ == 0) {
+      throw std::out_of_range("Vector is empty");
+    }
+    return data()[0];
+  }
+  const_reference back() const {
+    if (size_ == 0) {
+      throw std::out_of_range("Vector is empty");
+    }
+    return data()[size_ - 1];
+  }
+  value_type *data() noexcept {
+    return std::launder(reinterpret_cast<value_type *>(storage_));
+  }
+  const value_type *data() const noexcept {
+    return std::launder(reinterpret_cast<const value_type *>(storage_));
+  }
+
+  iterator begin() noexcept { return data(); }
+  iterator end() noexcept { return data() + size_; }
+  const_iterator begin() const noexcept { return data(); }
+  const_iterator end() const noexcept { return data() + size_; }
+  const_iterator cbegin() const noexcept { return data(); }
+  const_iterator cend() const noexcept { return data() + size_; }
+
+  bool empty() const noexcept { return size_ == 0; }
+  size_type size() const noexcept { return size_; }
+  size_type max_size() const noexcept { return N; }
+  void reserve(size_type size) { checkCapacity(size); }
+  size_type capacity() const noexcept { return N; }
+  void shrink_to_fit() noexcept {}
+  void clear() noexcept {
+    while (size_) data()[--size_].~value_type();
+  }
+
+  iterator insert(iterator pos, const_reference value) {
+    return emplace(pos, value);
+  }
+  template <typename... Args>
+  iterator emplace(const_iterator pos, Args &&...args) {
+    if (pos < cbegin() || pos > cend()) {
+      throw std::out_of_range("Out Of Range");
+    }
+    iterator new_pos = begin() + (pos - cbegin());
+    emplace_back(std::forward<Args>(args)...);
+    std::rotate(new_pos, end() - 1, end());
+    return new_pos;
+  }
+  void erase(iterator pos) {
+    if (pos < begin() || pos >= end()) {
+      throw std::out_of_range("Out Of Range");
+    }
+    std::move(pos + 1, end(), pos);
+    pop_back();
+  }
+  void push_back(const_reference value) { emplace_back(value); }
+  void push_back(value_type &&value) { emplace_back(std::move(value)); }
+  template <typename... Args>
+  reference emplace_back(Args &&...args) {
+    checkCapacity(size_ + 1);
+    new (slot(size_)) value_type(std::forward<Args>(args)...);
+    return data()[size_++];
+  }
+  void pop_back() noexcept {
+    if (size_ > 0) data()[--size_].~value_type();
+  }
+  void swap(static_vector &other) {
+    static_vector tmp(std::move(other));
+    other = std::move(*this);
+    *this = std::move(tmp);
+  }
+
+  template <typename... Args>
+  iterator insert_many(const_iterator pos, Args &&...args) {
+    if (pos < cbegin() || pos > cend()) {
+      throw std::out_of_range("Out Of Range");
+    }
+    if constexpr (sizeof...(Args) == 0) return begin() + (pos - cbegin());
+    // Проверяем ёмкость заранее, чтобы не оставить вектор вставленным
+    // наполовину.
+    checkCapacity(size_ + sizeof...(Args));
+    iterator new_pos = begin() + (pos - cbegin());
+    size_type old_size = size_;
+    (emplace_back(std::forward<Args>(args)), ...);
+    std::rotate(new_pos, begin() + old_size, end());
+    return new_pos + sizeof...(Args) - 1;
+  }
+
+  template <typename... Args>
+  void insert_many_back(Args &&...args) {
+    insert_many(cend(), std::forward<Args>(args)...);
+  }
+
+ private:
+  void checkCapacity(size_type size) const {
+    if (size > N) {
+      throw std::length_error("static_vector capacity exceeded");
+    }
+  }
+  void *slot(size_type pos) noexcept { return storage_ + pos * sizeof(T); }
+
+  // Для конструкторов: если build бросит, уже созданные элементы
+  // разрушаются, ведь деструктор недостроенного объекта не вызовется.
+  template <typename Build>
+  void constructAll(size_type n, Build build) {
+    try {
+      for (; size_ < n; ++size_) build(slot(size_), size_);
+    } catch (...) {
+      clear();
+      throw;
+    }
+  }
+
+  size_type size_;
+  alignas(value_type) unsigned char storage_[(N == 0 ? 1 : N) * sizeof(T)];
+};
+}  // namespace s21
+
+#endif  // CONTAINERS_SRC_S21_STATIC_VECTOR_H_
@@ -0,0 +1,260 @@
+#ifndef CONTAINERS_SRC_S21_THREAD_POOL_H_
+#define CONTAINERS_SRC_S21_THREAD_POOL_H_
+
+#include <atomic>              // atomic memory_order
+#include <condition_variable>  // condition_variable
+#include <cstddef>             // size_t
+#include <exception>           // exception_ptr current_exception
+#include <memory>              // unique_ptr
+#include <mutex>               // mutex lock_guard unique_lock
+#include <thread>              // thread hardware_concurrency yield
+#include <utility>             // forward
+#include <vector>              // vector
+
+#include "s21_deque.h"
+#include "s21_queue.h"
+#include "s21_spin_wait.h"
+#include "s21_work_stealing_deque.h"
+
+namespace s21 {
+// Пул потоков с кражей работы для вложенного параллелизма fork/join.
+// У каждого рабочего свой work_stealing_deque задач: задачи, порождённые
+// рабочим, ложатся в его дек и обычно им же и выполняются, а простаивающие
+// рабочие крадут самые старые (и обычно самые крупные) из чужих деков.
+// Задачи от посторонних потоков идут в общую очередь под мьютексом.
+//
+// Ожидающий в parallel_invoke поток не спит, а выполняет другие задачи,
+// поэтому вложенные вызовы не исчерпывают рабочих.
+class thread_pool {
+ public:
+  using size_type = std::size_t;
+
+  // 0 — по числу аппаратных потоков.
+  explicit thread_pool(size_type threads = 0) {
+    if (threads == 0) threads = std::thread::hardware_concurrency();
+    if (threads == 0) threads = 1;
+    for (size_type i = 0; i < threads; ++i)
+      workers_.push_back(std::make_unique<Worker>());
+    try {
+      for (size_type i = 0; i < threads; ++i)
+        workers_[i]->thread = std::thread(&thread_pool::workerLoop, this, i);
+    } catch (...) {
+      shutdown();
+      throw;
+    }
+  }
+
+  thread_pool(const thread_pool &) = delete;
+  thread_pool &operator=(const thread_pool &) = delete;
+
+  ~thread_pool() { shutdown(); }
+
+  // Общий пул библиотеки, создаётся при первом обращении.
+  static thread_pool &shared() {
+    static thread_pool pool;
+    return pool;
+  }
+
+  size_type size() const noexcept { return workers_.size(); }
+
+  // Выполняет все функции, возможно параллельно, и возвращается, когда все
+  // они завершились. Первая выполняется в вызывающем потоке. Исключение
+  // первой по порядку упавшей функции передаётся вызывающему.
+  template <typename F, typename... Fs>
+  void parallel_invoke(F &&first, Fs &&...rest) {
+    Task tasks[sizeof...(Fs) + 1] = {Task(first), Task(rest)...};
+    runAll(tasks, sizeof...(Fs) + 1);
+  }
+
+  // Выполняет task(0) ... task(count - 1), возможно параллельно, task(0) —
+  // в вызывающем потоке. Исключения — как у parallel_invoke.
+  template <typename F>
+  void parallel_for(size_type count, const F &task) {
+    if (count == 0) return;
+    std::vector<Call<F>> calls(count, Call<F>{&task, 0});
+    deque<Task> tasks;
+    for (size_type i = 0; i < count; ++i) {
+      calls[i].index = i;
+      tasks.emplace_back(calls[i]);
+    }
+    runAll(tasks, count);
+  }
+
+ private:
+  // Задача живёт на стеке parallel_invoke и не владеет функцией.
+  class Task {
+   public:
+    template <typename F>
+    explicit Task(F &function)
+        : function_(&function), call_([](const void *f) {
+            (*static_cast<F *>(const_cast<void *>(f)))();
+          }) {}
+
+    void run() noexcept {
+      try {
+        call_(function_);
+      } catch (...) {
+        error = std::current_exception();
+      }
+      done.store(true, std::memory_order_release);
+    }
+
+    std::atomic<bool> done{false};
+    std::exception_ptr error;
+
+   private:
+    const void *function_;
+    void (*call_)(const void *);
+  };
+
+  // Вызов task(index) для parallel_for.
+  template <typename F>
+  struct Call {
+    const F *task;
+    size_type index;
+    void operator()() const { (*task)(index); }
+  };
+
+  // Первая задача выполняется здесь, остальные ставятся в пул.
+  template <typename Tasks>
+  void runAll(Tasks &tasks, size_type count) {
+    size_type submitted = 1;
+    try {
+      for (; submitted < count; ++submitted) submit(&tasks[submitted]);
+    } catch (...) {
+      // Поставленные задачи указывают на tasks вызывающего: до выхода их
+      // нужно дождаться.
+      for (size_type i = 1; i < submitted; ++i) waitFor(tasks[i]);
+      throw;
+    }
+    tasks[0].run();
+    for (size_type i = 1; i < count; ++i) waitFor(tasks[i]);
+    for (size_type i = 0; i < count; ++i)
+      if (tasks[i].error) std::rethrow_exception(tasks[i].error);
+  }
+
+  struct Worker {
+    work_stealing_deque<Task *> tasks;
+    std::thread thread;
+  };
+
+  // Рабочий, на котором выполняется текущий поток, если он из этого пула.
+  struct Current {
+    thread_pool *pool = nullptr;
+    size_type index = 0;
+  };
+  static Current &current() noexcept {
+    thread_local Current value;
+    return value;
+  }
+
+  bool isWorker() const noexcept { return current().pool == this; }
+
+  void submit(Task *task) {
+    if (isWorker()) {
+      workers_[current().index]->tasks.push(task);
+    } else {
+      std::lock_guard<std::mutex> lock(injection_mutex_);
+      injection_.push(task);
+      injected_.fetch_add(1, std::memory_order_release);
+    }
+    epoch_.fetch_add(1);
+    if (sleeping_.load() > 0) {
+      { std::lock_guard<std::mutex> lock(sleep_mutex_); }
+      wake_.notify_one();
+    }
+  }
+
+  // Своя задача, затем общая очередь, затем кража по кругу от соседа.
+  Task *findTask() {
+    Task *task = nullptr;
+    const bool worker = isWorker();
+    const size_type self = worker ? current().index : 0;
+    if (worker && workers_[self]->tasks.pop(task)) return task;
+    if (injected_.load(std::memory_order_acquire) > 0) {
+      std::lock_guard<std::mutex> lock(injection_mutex_);
+      if (!injection_.empty()) {
+        task = injection_.front();
+        injection_.pop();
+        injected_.fetch_sub(1, std::memory_order_relaxed);
+        return task;
+      }
+    }
+    for (size_type i = 1; i <= workers_.size(); ++i) {
+      const size_type victim = (self + i) % workers_.size();
+      if (worker && victim == self) continue;
+      if (workers_[victim]->tasks.steal(task)) return task;
+    }
+    return nullptr;
+  }
+
+  void waitFor(const Task &task) {
+    spin_wait waiter;
+    while (!task.done.load(std::memory_order_acquire)) {
+      if (Task *other = findTask()) {
+        other->run();
+        waiter.reset();
+      } else {
+        waiter.wait();
+      }
+    }
+  }
+
+  void workerLoop(size_type index) {
+    current() = Current{this, index};
+    spin_wait waiter;
+    while (!stopping_.load(std::memory_order_acquire)) {
+      if (Task *task = findTask()) {
+        task->run();
+        waiter.reset();
+        continue;
+      }
+      if (waiter.spinning()) {
+        waiter.wait();
+        continue;
+      }
+      // Засыпаем, только если с момента последнего поиска ничего не пришло.
+      sleeping_.fetch_add(1);
+      const unsigned long long seen = epoch_.load();
+      if (Task *task = findTask()) {
+        sleeping_.fetch_sub(1);
+        task->run();
+        waiter.reset();
+        continue;
+      }
+      {
+        std::unique_lock<std::mutex> lock(sleep_mutex_);
+        wake_.wait(lock, [&] {
+          return epoch_.load() != seen ||
+                 stopping_.load(std::memory_order_acquire);
+        });
+      }
+      sleeping_.fetch_sub(1);
+      waiter.reset();
+    }
+  }
+
+  void shutdown() noexcept {
+    {
+      std::lock_guard<std::mutex> lock(sleep_mutex_);
+      stopping_.store(true, std::memory_order_release);
+    }
+    wake_.notify_all();
+    for (auto &worker : workers_)
+      if (worker->thread.joinable()) worker->thread.join();
+  }
+
+  std::vector<std::unique_ptr<Worker>> workers_;
+  std::mutex injection_mutex_;
+  queue<Task *> injection_;
+  // Длина injection_, чтобы не брать мьютекс ради пустой очереди.
+  std::atomic<size_type> injected_{0};
+  std::mutex sleep_mutex_;
+  std::condition_variable wake_;
+  std::atomic<unsigned long long> epoch_{0};
+  std::atomic<size_type> sleeping_{0};
+  std::atomic<bool> stopping_{false};
+};
+}  // namespace s21
+
+#endif  // CONTAINERS_SRC_S21_THREAD_POOL_H_
@@ -0,0 +1,474 @@
+#ifndef CONTAINERS_SRC_S21_UNROLLED_LIST_H_
+#define CONTAINERS_SRC_S21_UNROLLED_LIST_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <limits>
+#include <new>
+#include <utility>
+
+namespace S21 {
+// По умолчанию узел держит около 256 байт значений, но не меньше 4 штук.
+template <typename T>
+constexpr std::size_t kUnrolledDefaultCapacity =
+    256 / sizeof(T) > 4 ? 256 / sizeof(T) : 4;
+
+// Развёрнутый список: каждый узел хранит до NodeCapacity значений подряд,
+// поэтому обход идёт по непрерывной памяти, а вставка в середину сдвигает
+// не больше одного узла. Переполненный узел делится пополам, узел,
+// опустевший меньше чем наполовину, сливается со следующим, если они
+// помещаются в один.
+//
+// В отличие от S21::List, вставка и удаление делают недействительными
+// итераторы на элементы затронутых узлов.
+template <typename T, std::size_t NodeCapacity = kUnrolledDefaultCapacity<T>>
+class unrolled_list {
+  static_assert(NodeCapacity >= 2, "node must hold at least two values");
+
+  struct NodeBase;
+  struct Node;
+  class UnrolledIterator;
+  class UnrolledConstIterator;
+
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using iterator = UnrolledIterator;
+  using const_iterator = UnrolledConstIterator;
+  using size_type = std::size_t;
+
+  unrolled_list() noexcept : sentinel_{&sentinel_, &sentinel_, 0}, size_(0) {}
+
+  unrolled_list(size_type n) : unrolled_list() {
+    for (; n > 0; --n) emplace_back();
+  }
+
+  unrolled_list(std::initializer_list<value_type> const &items)
+      : unrolled_list() {
+    for (const_reference item : items) push_back(item);
+  }
+
+  unrolled_list(const unrolled_list &l) : unrolled_list() {
+    for (const_iterator it = l.begin(); it != l.end(); ++it) push_back(*it);
+  }
+
+  unrolled_list(unrolled_list &&l) noexcept : unrolled_list() { swap(l); }
+
+  ~unrolled_list() { clear(); }
+
+  unrolled_list &operator=(const unrolled_list &l) {
+    if (this != &l) {
+      unrolled_list tmp(l);
+      swap(tmp);
+    }
+    return *this;
+  }
+
+  unrolled_list &operator=(unrolled_list &&l) noexcept {
+    if (this != &l) {
+      clear();
+      swap(l);
+    }
+    return *this;
+  }
+
+  reference front() { return asNode(sentinel_.next_)->values()[0]; }
+  reference back() {
+    return asNode(sentinel_.prev_)->values()[sentinel_.prev_->count_ - 1];
+  }
+  const_reference front() const {
+    return asNode(sentinel_.next_)->values()[0];
+  }
+  const_reference back() const {
+    return asNode(sentinel_.prev_)->values()[sentinel_.prev_->count_ - 1];
+  }
+
+  iterator begin() noexcept { return iterator(sentinel_.next_, 0); }
+  iterator end() noexcept { return iterator(&sentinel_, 0); }
+  const_iterator begin() const noexcept {
+    return const_iterator(sentinel_.next_, 0);
+  }
+  const_iterator end() const noexcept {
+    return const_iterator(const_cast<NodeBase *>(&sentinel_), 0);
+  }
+
+  bool empty() const noexcept { return size_ == 0; }
+  size_type size() const noexcept { return size_; }
+  size_type max_size() const noexcept {
+    return std::numeric_limits<size_type>::max();
+  }
+
+  void clear() noexcept {
+    NodeBase *node = sentinel_.next_;
+    while (node != &sentinel_) {
+      NodeBase *next = node->next_;
+      destroyNode(asNode(node));
+      node = next;
+    }
+    sentinel_.prev_ = sentinel_.next_ = &sentinel_;
+    size_ = 0;
+  }
+
+  iterator insert(const_iterator pos, const_reference value) {
+    return emplace(pos, value);
+  }
+
+  iterator insert(const_iterator pos, value_type &&value) {
+    return emplace(pos, std::move(value));
+  }
+
+  template <typename... Args>
+  iterator emplace(const_iterator pos, Args &&...args) {
+    NodeBase *node = pos.node_;
+    size_type index = pos.index_;
+    if (node == &sentinel_) {
+      node = sentinel_.prev_;
+      index = node->count_;
+      if (node == &sentinel_ || node->count_ == NodeCapacity) {
+        node = createNodeAfter(node);
+        index = 0;
+      }
+    } else if (node->count_ == NodeCapacity) {
+      if (index == 0 && node->prev_ == &sentinel_) {
+        node = createNodeAfter(&sentinel_);
+      } else {
+        // args могут ссылаться на значение, которое splitAt перенесёт в
+        // новый узел, поэтому значение строится до деления.
+        value_type value(std::forward<Args>(args)...);
+        NodeBase *upper = splitAt(node, NodeCapacity / 2);
+        if (index > NodeCapacity / 2) {
+          node = upper;
+          index -= NodeCapacity / 2;
+        }
+        return constructIn(node, index, std::move(value));
+      }
+    }
+    return constructIn(node, index, std::forward<Args>(args)...);
+  }
+
+  iterator erase(const_iterator pos) {
+    Node *node = asNode(pos.node_);
+    size_type index = pos.index_;
+    T *values = node->values();
+    std::move(values + index + 1, values + node->count_, values + index);
+    values[--node->count_].~T();
+    --size_;
+    if (node->count_ == 0) {
+      NodeBase *next = node->next_;
+      unlinkNode(node);
+      return iterator(next, 0);
+    }
+    mergeWithNext(node);
+    if (index < node->count_) return iterator(node, index);
+    return iterator(node->next_, 0);
+  }
+
+  void push_back(const_reference value) { emplace(end(), value); }
+  void push_back(value_type &&value) { emplace(end(), std::move(value)); }
+  void push_front(const_reference value) { emplace(begin(), value); }
+  void push_front(value_type &&value) { emplace(begin(), std::move(value)); }
+
+  template <typename... Args>
+  reference emplace_back(Args &&...args) {
+    return *emplace(end(), std::forward<Args>(args)...);
+  }
+
+  template <typename... Args>
+  reference emplace_front(Args &&...args) {
+    return *emplace(begin(), std::forward<Args>(args)...);
+  }
+
+  void pop_back() {
+    if (size_) erase(--end());
+  }
+
+  void pop_front() {
+    if (size_) erase(begin());
+  }
+
+  void swap(unrolled_list &l) noexcept {
+    if (this == &l) return;
+    std::swap(sentinel_.prev_, l.sentinel_.prev_);
+    std::swap(sentinel_.next_, l.sentinel_.next_);
+    std::swap(size_, l.size_);
+    attachSentinel();
+    l.attachSentinel();
+  }
+
+  // Переносит все узлы l перед pos. Если pos указывает в середину узла, этот
+  // узел сначала делится, остальное — перецепление указателей.
+  void splice(const_iterator pos, unrolled_list &l) {
+    if (this == &l || l.empty()) return;
+    NodeBase *before = pos.node_;
+    if (pos.index_ != 0) before = splitAt(before, pos.index_);
+    NodeBase *first = l.sentinel_.next_;
+    NodeBase *last = l.sentinel_.prev_;
+    first->prev_ = before->prev_;
+    before->prev_->next_ = first;
+    last->next_ = before;
+    before->prev_ = last;
+    size_ += l.size_;
+    l.sentinel_.prev_ = l.sentinel_.next_ = &l.sentinel_;
+    l.size_ = 0;
+  }
+
+  template <typename... Args>
+  iterator insert_many(const_iterator pos, Args &&...args) {
+    // Вставка может поделить узел, поэтому pos обновляется после каждой.
+    ([&] {
+      iterator inserted = emplace(pos, std::forward<Args>(args));
+      pos = ++inserted;
+    }(), ...);
+    return iterator(pos.node_, pos.index_);
+  }
+
+  template <typename... Args>
+  void insert_many_back(Args &&...args) {
+    (emplace_back(std::forward<Args>(args)), ...);
+  }
+
+  template <typename... Args>
+  void insert_many_front(Args &&...args) {
+    insert_many(begin(), std::forward<Args>(args)...);
+  }
+
+  // Число узлов; нужно для тестов и оценки заполненности.
+  size_type node_count() const noexcept {
+    size_type count = 0;
+    for (NodeBase *node = sentinel_.next_; node != &sentinel_;
+         node = node->next_)
+      ++count;
+    return count;
+  }
+
+ private:
+  class UnrolledIterator {
+   public:
+    friend class unrolled_list;
+    UnrolledIterator(NodeBase *node, size_type index)
+        : node_(node), index_(index) {}
+
+    UnrolledIterator &operator++() {
+      if (++index_ == node_->count_) {
+        node_ = node_->next_;
+        index_ = 0;
+      }
+      return *this;
+    }
+
+    UnrolledIterator &operator--() {
+      if (index_ == 0) {
+        node_ = node_->prev_;
+        index_ = node_->count_;
+      }
+      --index_;
+      return *this;
+    }
+
+    UnrolledIterator operator++(int) {
+      UnrolledIterator temp = *this;
+      ++*this;
+      return temp;
+    }
+
+    UnrolledIterator operator--(int) {
+      UnrolledIterator temp = *this;
+      --*this;
+      return temp;
+    }
+
+    bool operator==(const UnrolledIterator &l) const {
+      return node_ == l.node_ && index_ == l.index_;
+    }
+
+    bool operator!=(const UnrolledIterator &l) const { return !(*this == l); }
+
+    reference operator*() const { return asNode(node_)->values()[index_]; }
+
+    T *operator->() const { return asNode(node_)->values() + index_; }
+
+   private:
+    NodeBase *node_;
+    size_type index_;
+  };
+  class UnrolledConstIterator {
+   public:
+    friend class unrolled_list;
+    UnrolledConstIterator(const iterator &other)
+        : node_(other.node_), index_(other.index_) {}
+
+    UnrolledConstIterator(NodeBase *node, size_type index)
+        : node_(node), index_(index) {}
+
+    UnrolledConstIterator &operator++() {
+      if (++index_ == node_->count_) {
+        node_ = node_->next_;
+        index_ = 0;
+      }
+      return *this;
+    }
+
+    UnrolledConstIterator &operator--() {
+      if (index_ == 0) {
+        node_ = node_->prev_;
+        index_ = node_->count_;
+      }
+      --index_;
+      return *this;
+    }
+
+    UnrolledConstIterator operator++(int) {
+      UnrolledConstIterator temp = *this;
+      ++*this;
+      return temp;
+    }
+
+    UnrolledConstIterator operator--(int) {
+      UnrolledConstIterator temp = *this;
+      --*this;
+      return temp;
+    }
+
+    bool operator==(const UnrolledConstIterator &l) const {
+      return node_ == l.node_ && index_ == l.index_;
+    }
+
+    bool operator!=(const UnrolledConstIterator &l) const {
+      return !(*this == l);
+    }
+
+    const_reference operator*() const {
+      return asNode(node_)->values()[index_];
+    }
+
+    const T *operator->() const { return asNode(node_)->values() + index_; }
+
+   private:
+    NodeBase *node_;
+    size_type index_;
+  };
+
+  // У sentinel_ count_ всегда 0; у остальных узлов — от 1 до NodeCapacity.
+  struct NodeBase {
+    NodeBase *prev_;
+    NodeBase *next_;
+    size_type count_;
+  };
+  struct Node : NodeBase {
+    Node() : NodeBase{nullptr, nullptr, 0} {}
+    T *values() noexcept {
+      return std::launder(reinterpret_cast<T *>(storage_));
+    }
+    alignas(T) unsigned char storage_[NodeCapacity * sizeof(T)];
+  };
+
+  NodeBase sentinel_;
+  size_type size_;
+
+  static Node *asNode(NodeBase *node) noexcept {
+    return static_cast<Node *>(node);
+  }
+
+  void attachSentinel() noexcept {
+    if (size_) {
+      sentinel_.next_->prev_ = &sentinel_;
+      sentinel_.prev_->next_ = &sentinel_;
+    } else {
+      sentinel_.next_ = sentinel_.prev_ = &sentinel_;
+    }
+  }
+
+  NodeBase *createNodeAfter(NodeBase *pos) {
+    Node *node = new Node();
+    node->prev_ = pos;
+    node->next_ = pos->next_;
+    pos->next_->prev_ = node;
+    pos->next_ = node;
+    return node;
+  }
+
+  void unlinkNode(NodeBase *node) noexcept {
+    node->prev_->next_ = node->next_;
+    node->next_->prev_ = node->prev_;
+    delete asNode(node);
+  }
+
+  static void destroyNode(Node *node) noexcept {
+    T *values = node->values();
+    for (size_type i = 0; i < node->count_; ++i) values[i].~T();
+    delete node;
+  }
+
+  template <typename... Args>
+  iterator constructIn(NodeBase *node, size_type index, Args &&...args) {
+    try {
+      constructAt(asNode(node), index, std::forward<Args>(args)...);
+    } catch (...) {
+      if (node->count_ == 0) unlinkNode(node);
+      throw;
+    }
+    return iterator(node, index);
+  }
+
+  template <typename... Args>
+  void constructAt(Node *node, size_type index, Args &&...args) {
+    T *values = node->values();
+    new (values + node->count_) T(std::forward<Args>(args)...);
+    ++node->count_;
+    ++size_;
+    std::rotate(values + index, values + node->count_ - 1,
+                values + node->count_);
+  }
+
+  // Переносит count значений from в неинициализированную память to. Если
+  // перенос T может бросить, значения копируются: при исключении уже
+  // построенные копии разрушаются, а from остаётся как был.
+  static void relocate(T *from, size_type count, T *to) {
+    size_type built = 0;
+    try {
+      for (; built < count; ++built)
+        new (to + built) T(std::move_if_noexcept(from[built]));
+    } catch (...) {
+      while (built > 0) to[--built].~T();
+      throw;
+    }
+    for (size_type i = 0; i < count; ++i) from[i].~T();
+  }
+
+  // Переносит значения [index, count_) в новый узел сразу за node.
+  NodeBase *splitAt(NodeBase *node, size_type index) {
+    NodeBase *upper = createNodeAfter(node);
+    try {
+      relocate(asNode(node)->values() + index, node->count_ - index,
+               asNode(upper)->values());
+    } catch (...) {
+      unlinkNode(upper);
+      throw;
+    }
+    upper->count_ = node->count_ - index;
+    node->count_ = index;
+    return upper;
+  }
+
+  // Слияние необязательно: если перенос бросил, узлы остаются как были.
+  void mergeWithNext(Node *node) noexcept {
+    NodeBase *next = node->next_;
+    if (node->count_ >= NodeCapacity / 2 || next == &sentinel_ ||
+        node->count_ + next->count_ > NodeCapacity)
+      return;
+    try {
+      relocate(asNode(next)->values(), next->count_,
+               node->values() + node->count_);
+    } catch (...) {
+      return;
+    }
+    node->count_ += next->count_;
+    next->count_ = 0;
+    unlinkNode(next);
+  }
+};
+}  // namespace S21
+
+#endif  // CONTAINERS_SRC_S21_UNROLLED_LIST_H_
@@ -3,9 +3,12 @@
 
 #include <algorithm>         // copy begin end
 #include <cstddef>           // size_t
+#include <functional>        // less
 #include <initializer_list>  // initializer_list
 #include <limits>            // max
 #include <stdexcept>         // out_of_range
+#include <type_traits>       // is_trivially_destructible
+#include <utility>           // forward move move_if_noexcept
 
 namespace s21 {
 template <class T>
@@ -45,9 +48,16 @@ class Vector {
     v.size_ = 0;
     v.capacity_ = 0;
   }
+  Vector &operator=(const Vector &v) {
+    if (this != &v) {
+      Vector tmp(v);
+      swap(tmp);
+    }
+    return *this;
+  }
   Vector &operator=(Vector &&v) noexcept {
     if (this != &v) {
-      clear();
+      delete[] data_;
 
       data_ = v.data_;
       size_ = v.size_;
@@ -74,13 +84,13 @@ class Vector {
     return data_[pos];
   }
   reference operator[](size_type pos) { return data_[pos]; }
-  const_reference front() {
+  reference front() {
     if (size_ == 0) {
       throw std::out_of_range("Vector is empty");
     }
     return data_[0];
   }
-  const_reference back() {
+  reference back() {
     if (size_ == 0) {
       throw std::out_of_range("Vector is empty");
     }
@@ -99,7 +109,16 @@ class Vector {
   void reserve(size_type size) {
     if (size > capacity()) {
       value_type *new_data = new value_type[size];
-      std::copy(data_, data_ + size_, new_data);
+      // Элементы переносятся, если перенос не бросает, иначе копируются:
+      // при исключении исходный буфер остаётся целым.
+      try {
+        for (size_type i = 0; i < size_; ++i) {
+          new_data[i] = std::move_if_noexcept(data_[i]);
+        }
+      } catch (...) {
+        delete[] new_data;
+        throw;
+      }
       delete[] data_;
       data_ = new_data;
       capacity_ = size;
@@ -117,11 +136,12 @@ class Vector {
       capacity_ = size_;
     }
   }
+  // Буфер остаётся за вектором, как у std::vector, а элементы сбрасываются
+  // в value_type(), чтобы отпустить то, чем они владели.
   void clear() {
-    if (data_) {
-      delete[] data_;
+    for (size_type i = 0; i < size_; ++i) {
+      data_[i] = value_type();
     }
-    data_ = nullptr;
     size_ = 0;
   }
   iterator insert(iterator pos, const_reference value) {
@@ -150,23 +170,49 @@ class Vector {
     }
     --size_;
   }
+  // value может быть элементом самого вектора: после перевыделения он
+  // берётся из нового буфера.
   void push_back(const_reference value) {
     if (size_ == capacity_) {
-      if (capacity_ == 0) {
-        reserve(1);
-      } else {
-        reserve(capacity_ * 2);
-      }
+      const size_type index = indexOf(&value);
+      reserve(capacity_ == 0 ? 1 : capacity_ * 2);
+      data_[size_] = index < size_ ? data_[index] : value;
+    } else {
+      data_[size_] = value;
     }
-    data_[size_] = value;
     size_++;
   }
+  void push_back(value_type &&value) {
+    if (size_ == capacity_) {
+      const size_type index = indexOf(&value);
+      reserve(capacity_ == 0 ? 1 : capacity_ * 2);
+      data_[size_] = index < size_ ? std::move(data_[index]) : std::move(value);
+    } else {
+      data_[size_] = std::move(value);
+    }
+    size_++;
+  }
+  template <typename... Args>
+  reference emplace_back(Args &&...args) {
+    // Аргументы могут ссылаться на элементы самого вектора, поэтому значение
+    // создаётся до перевыделения.
+    value_type value(std::forward<Args>(args)...);
+    if (size_ == capacity_) {
+      reserve(capacity_ == 0 ? 1 : capacity_ * 2);
+    }
+    data_[size_] = std::move(value);
+    return data_[size_++];
+  }
+  // Снятый элемент, как и в clear(), отпускает то, чем владел.
   void pop_back() {
     if (size_ > 0) {
       size_--;
+      if constexpr (!std::is_trivially_destructible_v<value_type>) {
+        data_[size_] = value_type();
+      }
     }
   }
-  void swap(Vector &other) {
+  void swap(Vector &other) noexcept {
     std::swap(size_, other.size_);
     std::swap(capacity_, other.capacity_);
     std::swap(data_, other.data_);
@@ -193,6 +239,13 @@ class Vector {
   }
 
  private:
+  // Индекс элемента по адресу или size_, если адрес не из вектора.
+  size_type indexOf(const value_type *ptr) const {
+    std::less<const value_type *> less;
+    if (less(ptr, data_) || !less(ptr, data_ + size_)) return size_;
+    return static_cast<size_type>(ptr - data_);
+  }
+
   size_type size_;
   size_type capacity_;
   value_type *data_;
@@ -0,0 +1,145 @@
+#ifndef CONTAINERS_SRC_S21_WORK_STEALING_DEQUE_H_
+#define CONTAINERS_SRC_S21_WORK_STEALING_DEQUE_H_
+
+#include <atomic>       // atomic memory_order
+#include <cstddef>      // size_t ptrdiff_t
+#include <type_traits>  // is_trivially_copyable_v
+
+#include "s21_spin_wait.h"
+
+namespace s21 {
+// Дек Чейза — Лева для планировщика с кражей работы. Владелец кладёт и
+// забирает элементы снизу (push, pop — как стек), остальные потоки крадут
+// сверху (steal — как очередь). Спорят они только за последний элемент,
+// и этот спор решает CAS на top_.
+//
+// Кольцевой массив растёт вдвое, когда владельцу не хватает места. Вор мог
+// успеть взять указатель на старый массив, поэтому старые массивы живут до
+// разрушения дека. Элементы читаются ворами без блокировок, отсюда
+// требование тривиального копирования: в деке обычно лежат указатели.
+template <class T>
+class work_stealing_deque {
+  static_assert(std::is_trivially_copyable_v<T>,
+                "work_stealing_deque requires trivially copyable T");
+
+ public:
+  using value_type = T;
+  using reference = value_type &;
+  using size_type = std::size_t;
+
+  static constexpr size_type kMinCapacity = 64;
+
+  explicit work_stealing_deque(size_type capacity = kMinCapacity)
+      : array_(new Array(roundUp(capacity), nullptr)) {}
+
+  work_stealing_deque(const work_stealing_deque &) = delete;
+  work_stealing_deque &operator=(const work_stealing_deque &) = delete;
+
+  ~work_stealing_deque() {
+    Array *array = array_.load(std::memory_order_relaxed);
+    while (array) {
+      Array *previous = array->previous;
+      delete array;
+      array = previous;
+    }
+  }
+
+  // Только для владельца.
+  void push(value_type value) {
+    const std::ptrdiff_t bottom = bottom_.load(std::memory_order_relaxed);
+    const std::ptrdiff_t top = top_.load(std::memory_order_acquire);
+    Array *array = array_.load(std::memory_order_relaxed);
+    if (bottom - top >= static_cast<std::ptrdiff_t>(array->capacity))
+      array = grow(array, top, bottom);
+    array->put(bottom, value);
+    bottom_.store(bottom + 1, std::memory_order_release);
+  }
+
+  // Только для владельца: последний положенный элемент.
+  bool pop(reference out) {
+    const std::ptrdiff_t bottom = bottom_.load(std::memory_order_relaxed) - 1;
+    Array *array = array_.load(std::memory_order_relaxed);
+    bottom_.store(bottom);
+    std::ptrdiff_t top = top_.load();
+    if (top > bottom) {
+      bottom_.store(bottom + 1, std::memory_order_relaxed);
+      return false;
+    }
+    out = array->get(bottom);
+    if (top == bottom) {
+      // Последний элемент: его может одновременно красть вор.
+      const bool won = top_.compare_exchange_strong(top, top + 1);
+      bottom_.store(bottom + 1, std::memory_order_relaxed);
+      return won;
+    }
+    return true;
+  }
+
+  // Для любого потока: самый старый элемент. false и при пустом деке, и при
+  // проигранной гонке за элемент.
+  bool steal(reference out) {
+    std::ptrdiff_t top = top_.load();
+    const std::ptrdiff_t bottom = bottom_.load();
+    if (top >= bottom) return false;
+    Array *array = array_.load(std::memory_order_acquire);
+    const value_type value = array->get(top);
+    if (!top_.compare_exchange_strong(top, top + 1)) return false;
+    out = value;
+    return true;
+  }
+
+  // Из других потоков значения приблизительные.
+  bool empty() const noexcept { return size() == 0; }
+  size_type size() const noexcept {
+    const std::ptrdiff_t bottom = bottom_.load(std::memory_order_acquire);
+    const std::ptrdiff_t top = top_.load(std::memory_order_acquire);
+    return bottom > top ? static_cast<size_type>(bottom - top) : 0;
+  }
+  size_type capacity() const noexcept {
+    return array_.load(std::memory_order_acquire)->capacity;
+  }
+
+ private:
+  struct Array {
+    Array(size_type size, Array *prev)
+        : capacity(size),
+          mask(size - 1),
+          items(new std::atomic<value_type>[size]),
+          previous(prev) {}
+    ~Array() { delete[] items; }
+
+    value_type get(std::ptrdiff_t index) const noexcept {
+      return items[static_cast<size_type>(index) & mask].load(
+          std::memory_order_relaxed);
+    }
+    void put(std::ptrdiff_t index, value_type value) noexcept {
+      items[static_cast<size_type>(index) & mask].store(
+          value, std::memory_order_relaxed);
+    }
+
+    const size_type capacity;
+    const size_type mask;
+    std::atomic<value_type> *const items;
+    Array *const previous;
+  };
+
+  static size_type roundUp(size_type n) noexcept {
+    size_type capacity = 2;
+    while (capacity < n) capacity *= 2;
+    return capacity;
+  }
+
+  Array *grow(Array *array, std::ptrdiff_t top, std::ptrdiff_t bottom) {
+    Array *bigger = new Array(array->capacity * 2, array);
+    for (std::ptrdiff_t i = top; i < bottom; ++i) bigger->put(i, array->get(i));
+    array_.store(bigger, std::memory_order_release);
+    return bigger;
+  }
+
+  alignas(kCacheLineSize) std::atomic<std::ptrdiff_t> top_{0};
+  alignas(kCacheLineSize) std::atomic<std::ptrdiff_t> bottom_{0};
+  std::atomic<Array *> array_;
+};
+}  // namespace s21
+
+#endif  // CONTAINERS_SRC_S21_WORK_STEALING_DEQUE_H_
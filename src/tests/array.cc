@@ -0,0 +1,84 @@
+#include <gtest/gtest.h>
+
+#include <array>
+
+#include "../s21_containersplus.h"
+
+template <class T, std::size_t N>
+void checkEqArray(const s21::array<T, N> &a, const std::array<T, N> &b) {
+  ASSERT_EQ(a.size(), b.size());
+  for (std::size_t i = 0; i < a.size(); i++) EXPECT_EQ(a[i], b[i]);
+}
+
+constexpr int constexprSum() {
+  s21::array<int, 4> a{1, 2, 3};
+  a[3] = 4;
+  int sum = 0;
+  for (int v : a) sum += v;
+  return sum;
+}
+
+TEST(ArrayTest, DefaultConstructor) {
+  s21::array<int, 5> a;
+  std::array<int, 5> b{};
+  checkEqArray(a, b);
+  EXPECT_FALSE(a.empty());
+}
+
+TEST(ArrayTest, ZeroSize) {
+  s21::array<int, 0> a;
+  EXPECT_TRUE(a.empty());
+  EXPECT_EQ(a.size(), 0u);
+  EXPECT_EQ(a.begin(), a.end());
+}
+
+TEST(ArrayTest, InitializerListConstructor) {
+  s21::array<int, 5> a{1, 2, 3};
+  std::array<int, 5> b{1, 2, 3};
+  checkEqArray(a, b);
+  EXPECT_THROW((s21::array<int, 2>{1, 2, 3}), std::out_of_range);
+}
+
+TEST(ArrayTest, CopyAndMove) {
+  s21::array<std::string, 3> a{"a", "b", "c"};
+  s21::array<std::string, 3> b(a);
+  EXPECT_EQ(b[1], "b");
+  s21::array<std::string, 3> c(std::move(b));
+  EXPECT_EQ(c[2], "c");
+  s21::array<std::string, 3> d;
+  d = std::move(c);
+  EXPECT_EQ(d[0], "a");
+}
+
+TEST(ArrayTest, ElementAccess) {
+  s21::array<int, 3> a{4, 5, 6};
+  EXPECT_EQ(a.at(1), 5);
+  EXPECT_THROW(a.at(3), std::out_of_range);
+  EXPECT_EQ(a.front(), 4);
+  EXPECT_EQ(a.back(), 6);
+  EXPECT_EQ(*a.data(), 4);
+  EXPECT_EQ(a.end() - a.begin(), 3);
+  EXPECT_EQ(a.max_size(), 3u);
+  a.front() = 7;
+  a.back() = 9;
+  EXPECT_EQ(a[0], 7);
+  EXPECT_EQ(a[2], 9);
+}
+
+TEST(ArrayTest, SwapAndFill) {
+  s21::array<int, 3> a{1, 2, 3};
+  s21::array<int, 3> b;
+  b.fill(7);
+  a.swap(b);
+  std::array<int, 3> expected_a{7, 7, 7};
+  std::array<int, 3> expected_b{1, 2, 3};
+  checkEqArray(a, expected_a);
+  checkEqArray(b, expected_b);
+}
+
+TEST(ArrayTest, Constexpr) {
+  static_assert(constexprSum() == 10);
+  constexpr s21::array<int, 2> a{8, 9};
+  static_assert(a.size() == 2 && a[1] == 9 && a.at(0) == 8);
+  EXPECT_EQ(a.back(), 9);
+}
@@ -0,0 +1,102 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../s21_blocking_queue.h"
+
+using namespace std::chrono_literals;
+
+TEST(BlockingQueueTest, FifoAndCapacity) {
+  s21::blocking_queue<std::string> queue(3);
+  EXPECT_EQ(queue.capacity(), 3u);
+  std::string value;
+  EXPECT_FALSE(queue.try_pop(value));
+  for (int round = 0; round < 4; ++round) {
+    EXPECT_TRUE(queue.push("a"));
+    EXPECT_TRUE(queue.try_emplace(2, 'b'));
+    EXPECT_TRUE(queue.try_push(std::string("c")));
+    EXPECT_FALSE(queue.try_push("d"));
+    EXPECT_EQ(queue.size(), 3u);
+    for (const char *expected : {"a", "bb", "c"}) {
+      ASSERT_TRUE(queue.pop(value));
+      EXPECT_EQ(value, expected);
+    }
+    EXPECT_TRUE(queue.empty());
+  }
+}
+
+TEST(BlockingQueueTest, TimedWaits) {
+  s21::blocking_queue<int> queue(1);
+  int value = 0;
+  EXPECT_FALSE(queue.pop_for(value, 5ms));
+  EXPECT_TRUE(queue.push_for(1, 5ms));
+  EXPECT_FALSE(queue.push_for(2, 5ms));
+  EXPECT_TRUE(queue.pop_for(value, 5ms));
+  EXPECT_EQ(value, 1);
+}
+
+TEST(BlockingQueueTest, CloseWakesAllWaiters) {
+  s21::blocking_queue<int> queue(1);
+  std::vector<std::thread> waiters;
+  std::vector<int> results(4, -1);
+  for (int i = 0; i < 4; ++i)
+    waiters.emplace_back([&, i] {
+      int value;
+      results[i] = queue.pop(value) ? value : 0;
+    });
+  std::this_thread::sleep_for(10ms);
+  queue.push(7);
+  std::this_thread::sleep_for(10ms);
+  queue.close();
+  for (auto &waiter : waiters) waiter.join();
+  int delivered = 0;
+  for (int result : results) delivered += result;
+  EXPECT_EQ(delivered, 7);
+  EXPECT_TRUE(queue.closed());
+  EXPECT_FALSE(queue.push(1));
+}
+
+TEST(BlockingQueueTest, CloseKeepsRemainingItems) {
+  s21::blocking_queue<int> queue(4);
+  queue.push(1);
+  queue.push(2);
+  queue.close();
+  int value;
+  EXPECT_TRUE(queue.pop(value));
+  EXPECT_EQ(value, 1);
+  s21::Vector<int> rest;
+  EXPECT_EQ(queue.pop_all(rest), 1u);
+  EXPECT_EQ(rest[0], 2);
+  EXPECT_FALSE(queue.pop(value));
+  EXPECT_EQ(queue.pop_all(rest), 0u);
+}
+
+TEST(BlockingQueueTest, PipelineWithBatchDrain) {
+  const int producers = 3, per_producer = 20000;
+  s21::blocking_queue<int> queue(64);
+  std::vector<std::thread> threads;
+  for (int p = 0; p < producers; ++p)
+    threads.emplace_back([&queue] {
+      for (int i = 1; i <= per_producer; ++i) queue.push(i);
+    });
+  long long sum = 0;
+  std::size_t received = 0;
+  std::thread consumer([&] {
+    s21::Vector<int> batch;
+    while (queue.pop_all(batch) > 0) {
+      for (std::size_t i = 0; i < batch.size(); ++i) sum += batch[i];
+      received += batch.size();
+      batch.clear();
+    }
+  });
+  for (auto &thread : threads) thread.join();
+  queue.close();
+  consumer.join();
+  EXPECT_EQ(received, std::size_t{producers} * per_producer);
+  EXPECT_EQ(sum, 1LL * producers * per_producer * (per_producer + 1) / 2);
+  s21::Vector<int> empty;
+  EXPECT_EQ(queue.drain_into(empty), 0u);
+}
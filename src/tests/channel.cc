@@ -0,0 +1,102 @@
+#include <gtest/gtest.h>
+
+#include "../s21_channel.h"
+
+#if defined(__cpp_impl_coroutine) && __has_include(<coroutine>)
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace {
+s21::detached_task produce(s21::channel<int> &channel, int from, int count,
+                           std::vector<bool> &accepted) {
+  for (int i = from; i < from + count; ++i)
+    accepted.push_back(co_await channel.push(i));
+}
+
+s21::detached_task consume(s21::channel<int> &channel,
+                           std::vector<int> &received) {
+  while (auto value = co_await channel.pop()) received.push_back(*value);
+}
+}  // namespace
+
+TEST(ChannelTest, BufferedFifo) {
+  s21::manual_executor executor;
+  s21::channel<int> channel(4, executor);
+  std::vector<bool> accepted;
+  std::vector<int> received;
+  produce(channel, 0, 100, accepted).start(executor);
+  consume(channel, received).start(executor);
+  executor.run();
+  EXPECT_EQ(accepted.size(), 100u);
+  EXPECT_EQ(received.size(), 100u);
+  for (int i = 0; i < 100; ++i) EXPECT_EQ(received[i], i);
+  // Потребитель ждёт следующего значения, пока канал не закроют
+  channel.close();
+  EXPECT_EQ(executor.run(), 1u);
+}
+
+TEST(ChannelTest, RendezvousAndManyProducers) {
+  s21::manual_executor executor;
+  s21::channel<int> channel(0, executor);
+  std::vector<bool> accepted;
+  std::vector<int> received;
+  produce(channel, 0, 10, accepted).start(executor);
+  produce(channel, 100, 10, accepted).start(executor);
+  executor.run();
+  EXPECT_TRUE(accepted.empty());
+  consume(channel, received).start(executor);
+  executor.run();
+  EXPECT_EQ(received.size(), 20u);
+  EXPECT_EQ(accepted.size(), 20u);
+  long long sum = 0;
+  for (int value : received) sum += value;
+  EXPECT_EQ(sum, 45 + 1045);
+  channel.close();
+  executor.run();
+}
+
+TEST(ChannelTest, CloseReleasesProducersAndDrains) {
+  s21::manual_executor executor;
+  s21::channel<int> channel(2, executor);
+  std::vector<bool> accepted;
+  produce(channel, 0, 5, accepted).start(executor);
+  executor.run();
+  EXPECT_EQ(channel.size(), 2u);
+  channel.close();
+  executor.run();
+  EXPECT_EQ(accepted, (std::vector<bool>{true, true, false, false, false}));
+  std::vector<int> received;
+  consume(channel, received).start(executor);
+  executor.run();
+  EXPECT_EQ(received, (std::vector<int>{0, 1}));
+}
+
+TEST(ChannelTest, MoveOnlyValuesAndCleanup) {
+  s21::manual_executor executor;
+  auto counter = std::make_shared<int>(0);
+  {
+    s21::channel<std::shared_ptr<int>> channel(3, executor);
+    auto fill = [](s21::channel<std::shared_ptr<int>> &target,
+                   std::shared_ptr<int> value) -> s21::detached_task {
+      for (int i = 0; i < 3; ++i) co_await target.push(value);
+    };
+    fill(channel, counter).start(executor);
+    executor.run();
+    EXPECT_EQ(counter.use_count(), 4);
+  }
+  EXPECT_EQ(counter.use_count(), 1);
+  s21::channel<std::unique_ptr<std::string>> strings(1, executor);
+  std::string out;
+  auto roundTrip = [](s21::channel<std::unique_ptr<std::string>> &target,
+                      std::string &result) -> s21::detached_task {
+    co_await target.push(std::make_unique<std::string>("moved"));
+    result = **co_await target.pop();
+  };
+  roundTrip(strings, out).start(executor);
+  executor.run();
+  EXPECT_EQ(out, "moved");
+}
+
+#endif  // __cpp_impl_coroutine
@@ -0,0 +1,59 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../s21_concurrent_stack.h"
+
+TEST(ConcurrentStackTest, SingleThreadLifo) {
+  s21::concurrent_stack<std::string> stack;
+  std::string value;
+  EXPECT_TRUE(stack.empty());
+  EXPECT_FALSE(stack.try_pop(value));
+  for (int i = 0; i < 200; ++i) stack.push(std::to_string(i));
+  stack.emplace(3, 'x');
+  EXPECT_FALSE(stack.empty());
+  stack.pop(value);
+  EXPECT_EQ(value, "xxx");
+  for (int i = 199; i >= 0; --i) {
+    ASSERT_TRUE(stack.try_pop(value));
+    EXPECT_EQ(value, std::to_string(i));
+  }
+  EXPECT_TRUE(stack.empty());
+}
+
+TEST(ConcurrentStackTest, ReleasesAllValues) {
+  auto counter = std::make_shared<int>(0);
+  {
+    s21::concurrent_stack<std::shared_ptr<int>> stack;
+    std::shared_ptr<int> out;
+    for (int i = 0; i < 500; ++i) stack.push(counter);
+    for (int i = 0; i < 300; ++i) stack.pop(out);
+    out.reset();
+    EXPECT_EQ(counter.use_count(), 201);
+  }
+  EXPECT_EQ(counter.use_count(), 1);
+}
+
+TEST(ConcurrentStackTest, ConcurrentPushPop) {
+  const int threads = 6, per_thread = 20000;
+  s21::concurrent_stack<int> stack;
+  std::vector<std::atomic<int>> seen(threads * per_thread);
+  std::vector<std::thread> pool;
+  for (int t = 0; t < threads; ++t)
+    pool.emplace_back([&, t] {
+      int value;
+      for (int i = 0; i < per_thread; ++i) {
+        stack.push(t * per_thread + i);
+        // Половина потоков сразу забирает элемент, остальные только кладут
+        if (t % 2 && stack.try_pop(value)) seen[value].fetch_add(1);
+      }
+    });
+  for (auto &thread : pool) thread.join();
+  int value;
+  while (stack.try_pop(value)) seen[value].fetch_add(1);
+  for (auto &count : seen) ASSERT_EQ(count.load(), 1);
+}
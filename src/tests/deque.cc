@@ -0,0 +1,153 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <deque>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../s21_containers.h"
+#include "../s21_deque.h"
+
+TEST(DequeTest, MatchesStdDequeOnRandomOperations) {
+  s21::deque<int> deque;
+  std::deque<int> expected;
+  std::mt19937 rng(7);
+  for (int i = 0; i < 20000; ++i) {
+    switch (rng() % 5) {
+      case 0:
+      case 1:
+        deque.push_back(i);
+        expected.push_back(i);
+        break;
+      case 2:
+        deque.push_front(i);
+        expected.push_front(i);
+        break;
+      case 3:
+        deque.pop_back();
+        if (!expected.empty()) expected.pop_back();
+        break;
+      default:
+        deque.pop_front();
+        if (!expected.empty()) expected.pop_front();
+    }
+    ASSERT_EQ(deque.size(), expected.size());
+    if (!expected.empty()) {
+      ASSERT_EQ(deque.front(), expected.front());
+      ASSERT_EQ(deque.back(), expected.back());
+    }
+  }
+  for (std::size_t i = 0; i < expected.size(); ++i)
+    EXPECT_EQ(deque[i], expected[i]);
+  EXPECT_TRUE(std::equal(deque.begin(), deque.end(), expected.begin(),
+                         expected.end()));
+}
+
+TEST(DequeTest, ReferencesSurviveEndInsertions) {
+  s21::deque<std::string> deque{"middle"};
+  std::string *middle = &deque.front();
+  for (int i = 0; i < 5000; ++i) {
+    deque.push_back(std::to_string(i));
+    deque.emplace_front(3, 'x');
+  }
+  EXPECT_EQ(middle, &deque[5000]);
+  EXPECT_EQ(*middle, "middle");
+  EXPECT_EQ(deque.front(), "xxx");
+  EXPECT_EQ(deque.back(), "4999");
+  for (int i = 0; i < 4000; ++i) {
+    deque.pop_front();
+    deque.pop_back();
+  }
+  EXPECT_EQ(*middle, "middle");
+  EXPECT_EQ(deque.at(1000), "middle");
+  EXPECT_THROW(deque.at(deque.size()), std::out_of_range);
+}
+
+TEST(DequeTest, RandomAccessIterators) {
+  s21::deque<int> deque;
+  for (int i = 0; i < 1000; ++i) deque.push_front(i);
+  std::sort(deque.begin(), deque.end());
+  for (int i = 0; i < 1000; ++i) ASSERT_EQ(deque[i], i);
+  auto it = deque.begin() + 700;
+  EXPECT_EQ(*it, 700);
+  EXPECT_EQ(it[-600], 100);
+  EXPECT_EQ(*(it - 700), 0);
+  EXPECT_EQ(deque.end() - it, 300);
+  EXPECT_EQ(*(deque.end() - 1), 999);
+  EXPECT_TRUE(deque.begin() < it && it < deque.end());
+  s21::deque<int>::const_iterator cit = it;
+  EXPECT_EQ(cit - deque.cbegin(), 700);
+  int expected = 999;
+  for (auto rit = deque.end(); rit != deque.begin();)
+    EXPECT_EQ(*--rit, expected--);
+  const s21::deque<int> &view = deque;
+  EXPECT_EQ(std::accumulate(view.begin(), view.end(), 0), 999 * 1000 / 2);
+  EXPECT_EQ(std::distance(view.begin(), view.end()), 1000);
+}
+
+TEST(DequeTest, BlockBoundariesAndEmpty) {
+  s21::deque<int> deque;
+  EXPECT_TRUE(deque.begin() == deque.end());
+  const int block = static_cast<int>(s21::deque<int>::kBlockSize);
+  for (int i = 0; i < block; ++i) deque.push_back(i);
+  EXPECT_EQ(deque.end() - deque.begin(), block);
+  EXPECT_EQ(*--deque.end(), block - 1);
+  for (int i = 0; i < 3 * block; ++i) {
+    deque.push_back(-1);
+    deque.pop_back();
+    deque.push_front(-2);
+    deque.pop_front();
+  }
+  EXPECT_EQ(deque.size(), static_cast<std::size_t>(block));
+  while (!deque.empty()) deque.pop_front();
+  deque.pop_front();
+  EXPECT_TRUE(deque.begin() == deque.end());
+  deque.push_front(5);
+  EXPECT_EQ(deque.front(), 5);
+  EXPECT_EQ(deque.back(), 5);
+  deque.clear();
+  deque.shrink_to_fit();
+  EXPECT_TRUE(deque.empty());
+  EXPECT_EQ(deque.begin(), deque.end());
+}
+
+TEST(DequeTest, OwnsElements) {
+  auto counter = std::make_shared<int>(0);
+  {
+    s21::deque<std::shared_ptr<int>> deque;
+    for (int i = 0; i < 100; ++i) {
+      deque.push_back(counter);
+      deque.push_front(counter);
+    }
+    s21::deque<std::shared_ptr<int>> copy(deque);
+    EXPECT_EQ(counter.use_count(), 401);
+    s21::deque<std::shared_ptr<int>> moved;
+    moved = std::move(copy);
+    EXPECT_TRUE(copy.empty());
+    deque.clear();
+    EXPECT_EQ(counter.use_count(), 201);
+  }
+  EXPECT_EQ(counter.use_count(), 1);
+
+  s21::deque<std::unique_ptr<int>> owners;
+  owners.emplace_back(std::make_unique<int>(1));
+  owners.push_front(std::make_unique<int>(0));
+  EXPECT_EQ(*owners.front(), 0);
+  EXPECT_EQ(*owners.back(), 1);
+}
+
+TEST(DequeTest, BacksStackAndQueue) {
+  s21::queue<int, s21::deque<int>> queue({1, 2, 3});
+  queue.push(4);
+  EXPECT_EQ(queue.front(), 1);
+  EXPECT_EQ(queue.back(), 4);
+  queue.pop();
+  EXPECT_EQ(queue.front(), 2);
+  s21::stack<int, s21::deque<int>> stack({1, 2, 3});
+  stack.pop();
+  EXPECT_EQ(stack.top(), 2);
+  EXPECT_EQ(stack.size(), 2u);
+}
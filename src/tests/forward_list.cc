@@ -0,0 +1,158 @@
+#include <gtest/gtest.h>
+
+#include <forward_list>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../s21_containersplus.h"
+
+template <class T>
+void checkEqForward(const S21::forward_list<T> &a,
+                    const std::vector<T> &expected) {
+  auto it = a.begin();
+  for (const T &value : expected) {
+    ASSERT_NE(it, a.end());
+    EXPECT_EQ(*it++, value);
+  }
+  EXPECT_EQ(it, a.end());
+}
+
+TEST(ForwardListTest, Constructors) {
+  S21::forward_list<int> empty;
+  EXPECT_TRUE(empty.empty());
+  EXPECT_EQ(empty.begin(), empty.end());
+  S21::forward_list<int> sized(3);
+  checkEqForward(sized, {0, 0, 0});
+  S21::forward_list<std::string> items{"a", "b", "c"};
+  checkEqForward(items, {"a", "b", "c"});
+  S21::forward_list<std::string> copy(items);
+  checkEqForward(copy, {"a", "b", "c"});
+  S21::forward_list<std::string> moved(std::move(copy));
+  checkEqForward(moved, {"a", "b", "c"});
+  EXPECT_TRUE(copy.empty());
+  copy = moved;
+  checkEqForward(copy, {"a", "b", "c"});
+  moved = std::move(items);
+  checkEqForward(moved, {"a", "b", "c"});
+}
+
+TEST(ForwardListTest, ObjectIsSmall) {
+  EXPECT_LE(sizeof(S21::forward_list<int>),
+            sizeof(void *) + sizeof(std::shared_ptr<int>));
+}
+
+TEST(ForwardListTest, InsertAndEraseAfter) {
+  S21::forward_list<int> list;
+  list.push_front(3);
+  list.emplace_front(1);
+  auto it = list.insert_after(list.begin(), 2);
+  EXPECT_EQ(*it, 2);
+  list.insert_after(list.before_begin(), 0);
+  checkEqForward(list, {0, 1, 2, 3});
+  auto next = list.erase_after(list.begin());
+  EXPECT_EQ(*next, 2);
+  checkEqForward(list, {0, 2, 3});
+  list.erase_after(list.before_begin(), list.end());
+  EXPECT_TRUE(list.empty());
+  list.pop_front();
+  EXPECT_TRUE(list.empty());
+}
+
+TEST(ForwardListTest, SharedPool) {
+  auto pool = S21::forward_list<int>::make_pool();
+  std::vector<S21::forward_list<int>> chains;
+  for (int i = 0; i < 100; ++i) {
+    chains.emplace_back(pool);
+    for (int j = 0; j < 3; ++j) chains.back().push_front(i * 10 + j);
+  }
+  // 300 узлов помещаются в несколько блоков пула
+  EXPECT_LT(pool->slab_count(), 10u);
+  chains[5].clear();
+  EXPECT_TRUE(chains[5].empty());
+  checkEqForward(chains[7], {72, 71, 70});
+}
+
+TEST(ForwardListTest, DefaultPoolIsSharedPerThread) {
+  auto pool = S21::forward_list<int>::default_pool();
+  const std::size_t slabs = pool->slab_count();
+  std::vector<S21::forward_list<int>> chains(100);
+  for (int i = 0; i < 100; ++i)
+    for (int j = 0; j < 3; ++j) chains[i].push_front(i * 10 + j);
+  // Без переданного пула короткие цепочки не заводят по пулу на каждую.
+  EXPECT_LT(pool->slab_count() - slabs, 10u);
+  checkEqForward(chains[7], {72, 71, 70});
+  std::shared_ptr<S21::forward_list<int>::pool_type> other;
+  std::thread([&other] {
+    other = S21::forward_list<int>::default_pool();
+  }).join();
+  EXPECT_NE(other, pool);
+}
+
+TEST(ForwardListTest, DefaultPoolReplacedAfterJoin) {
+  S21::forward_list<int> chain{1, 2, 3};
+  auto before = S21::forward_list<int>::default_pool();
+  auto pool = S21::forward_list<int>::make_pool();
+  S21::forward_list<int> target(pool);
+  // Пул потока влит в pool: дальше поток получает новый.
+  target.splice_after(target.before_begin(), chain);
+  checkEqForward(target, {1, 2, 3});
+  auto after = S21::forward_list<int>::default_pool();
+  EXPECT_NE(after, before);
+  EXPECT_NE(after, pool);
+  chain.push_front(4);
+  checkEqForward(chain, {4});
+}
+
+TEST(ForwardListTest, SpliceAfter) {
+  S21::forward_list<int> list1{1, 2, 3};
+  S21::forward_list<int> list2{10, 20, 30, 40};
+  list1.splice_after(list1.begin(), list2, list2.begin());
+  checkEqForward(list1, {1, 20, 2, 3});
+  checkEqForward(list2, {10, 30, 40});
+  list1.splice_after(list1.before_begin(), list2, list2.before_begin(),
+                     ++list2.begin());
+  checkEqForward(list1, {10, 1, 20, 2, 3});
+  checkEqForward(list2, {30, 40});
+  {
+    S21::forward_list<int> list3{7, 8};
+    list1.splice_after(list1.begin(), list3);
+    EXPECT_TRUE(list3.empty());
+  }
+  checkEqForward(list1, {10, 7, 8, 1, 20, 2, 3});
+}
+
+TEST(ForwardListTest, MergeSortReverse) {
+  S21::forward_list<int> list1{1, 4, 6};
+  S21::forward_list<int> list2{2, 3, 5, 7};
+  list1.merge(list2);
+  checkEqForward(list1, {1, 2, 3, 4, 5, 6, 7});
+  EXPECT_TRUE(list2.empty());
+  list1.reverse();
+  checkEqForward(list1, {7, 6, 5, 4, 3, 2, 1});
+  list1.sort();
+  checkEqForward(list1, {1, 2, 3, 4, 5, 6, 7});
+  list1.sort(std::greater<int>());
+  checkEqForward(list1, {7, 6, 5, 4, 3, 2, 1});
+
+  S21::forward_list<std::pair<int, char>> stable{
+      {2, 'a'}, {1, 'b'}, {2, 'c'}, {1, 'd'}};
+  stable.sort([](const std::pair<int, char> &a, const std::pair<int, char> &b) {
+    return a.first < b.first;
+  });
+  checkEqForward(stable, {{1, 'b'}, {1, 'd'}, {2, 'a'}, {2, 'c'}});
+}
+
+TEST(ForwardListTest, UniqueAndRemove) {
+  S21::forward_list<int> list{1, 1, 2, 2, 2, 3, 1, 1};
+  list.unique();
+  checkEqForward(list, {1, 2, 3, 1});
+  EXPECT_EQ(list.remove(1), 2u);
+  checkEqForward(list, {2, 3});
+  EXPECT_EQ(list.remove_if([](int v) { return v > 2; }), 1u);
+  checkEqForward(list, {2});
+  S21::forward_list<int> aliased{5, 1, 5};
+  EXPECT_EQ(aliased.remove(aliased.front()), 2u);
+  checkEqForward(aliased, {1});
+}
@@ -0,0 +1,164 @@
+#include <gtest/gtest.h>
+
+#include <type_traits>
+#include <vector>
+
+#include "../s21_containersplus.h"
+
+struct Timer {
+  explicit Timer(int id) : id(id) {}
+  int id;
+  S21::list_hook hook;
+};
+
+struct Connection {
+  explicit Connection(int id) : id(id) {}
+  int id;
+  S21::auto_unlink_hook hook;
+};
+
+using TimerList = S21::intrusive_list<Timer, &Timer::hook>;
+using ConnectionList = S21::intrusive_list<Connection, &Connection::hook>;
+
+template <class List>
+void checkIds(const List &list, const std::vector<int> &expected) {
+  ASSERT_EQ(list.size(), expected.size());
+  auto it = list.begin();
+  for (int id : expected) EXPECT_EQ((it++)->id, id);
+  EXPECT_EQ(it, list.end());
+}
+
+TEST(IntrusiveListTest, PushAndIterate) {
+  Timer a(1), b(2), c(3);
+  TimerList list;
+  EXPECT_TRUE(list.empty());
+  list.push_back(b);
+  list.push_back(c);
+  list.push_front(a);
+  checkIds(list, {1, 2, 3});
+  EXPECT_EQ(&list.front(), &a);
+  EXPECT_EQ(&list.back(), &c);
+  EXPECT_TRUE(b.hook.is_linked());
+  auto it = list.end();
+  EXPECT_EQ((--it)->id, 3);
+  EXPECT_EQ((--it)->id, 2);
+}
+
+TEST(IntrusiveListTest, EraseByReference) {
+  Timer a(1), b(2), c(3);
+  TimerList list;
+  list.push_back(a);
+  list.push_back(b);
+  list.push_back(c);
+  list.erase(b);
+  EXPECT_FALSE(b.hook.is_linked());
+  checkIds(list, {1, 3});
+  auto next = list.erase(list.iterator_to(a));
+  EXPECT_EQ(&*next, &c);
+  list.pop_back();
+  EXPECT_TRUE(list.empty());
+  list.pop_front();
+  EXPECT_TRUE(list.empty());
+}
+
+TEST(IntrusiveListTest, ClearAndDestructionUnlink) {
+  Timer a(1), b(2);
+  {
+    TimerList list;
+    list.push_back(a);
+    list.push_back(b);
+  }
+  EXPECT_FALSE(a.hook.is_linked());
+  EXPECT_FALSE(b.hook.is_linked());
+  TimerList list;
+  list.push_back(a);
+  list.clear();
+  EXPECT_FALSE(a.hook.is_linked());
+  EXPECT_EQ(list.size(), 0u);
+}
+
+TEST(IntrusiveListTest, CopyOfElementIsUnlinked) {
+  Timer a(1);
+  TimerList list;
+  list.push_back(a);
+  Timer copy(a);
+  EXPECT_FALSE(copy.hook.is_linked());
+  copy = a;
+  EXPECT_FALSE(copy.hook.is_linked());
+  EXPECT_EQ(list.size(), 1u);
+}
+
+TEST(IntrusiveListTest, AutoUnlinkOnDestruction) {
+  ConnectionList list;
+  Connection a(1);
+  {
+    Connection b(2);
+    list.push_back(a);
+    list.push_back(b);
+    EXPECT_EQ(list.size(), 2u);
+  }
+  checkIds(list, {1});
+  a.hook.unlink();
+  EXPECT_TRUE(list.empty());
+}
+
+TEST(IntrusiveListTest, Splice) {
+  Timer a(1), b(2), c(3), d(4), e(5);
+  TimerList list1, list2;
+  list1.push_back(a);
+  list1.push_back(b);
+  list2.push_back(c);
+  list2.push_back(d);
+  list2.push_back(e);
+  list1.splice(list1.begin(), list2, list2.iterator_to(d));
+  checkIds(list1, {4, 1, 2});
+  checkIds(list2, {3, 5});
+  list1.splice(list1.end(), list2, list2.begin(), list2.end());
+  checkIds(list1, {4, 1, 2, 3, 5});
+  EXPECT_TRUE(list2.empty());
+  list1.splice(list1.begin(), list1, list1.iterator_to(e));
+  checkIds(list1, {5, 4, 1, 2, 3});
+  list2.splice(list2.end(), list1);
+  checkIds(list2, {5, 4, 1, 2, 3});
+  EXPECT_TRUE(list1.empty());
+}
+
+TEST(IntrusiveListTest, MoveAndSwap) {
+  Timer a(1), b(2), c(3);
+  TimerList list1;
+  list1.push_back(a);
+  list1.push_back(b);
+  TimerList list2(std::move(list1));
+  EXPECT_TRUE(list1.empty());
+  checkIds(list2, {1, 2});
+  list1.push_back(c);
+  list1.swap(list2);
+  checkIds(list1, {1, 2});
+  checkIds(list2, {3});
+  list2 = std::move(list1);
+  checkIds(list2, {1, 2});
+  EXPECT_FALSE(c.hook.is_linked());
+}
+
+// Два хука на разных смещениях: элемент сразу в двух списках.
+struct Job {
+  explicit Job(int id) : id(id) {}
+  S21::list_hook by_queue;
+  int id;
+  S21::auto_unlink_hook by_owner;
+};
+
+TEST(IntrusiveListTest, TwoHooksInOneElement) {
+  static_assert(std::is_standard_layout_v<Job>);
+  Job a(1), b(2);
+  S21::intrusive_list<Job, &Job::by_queue> queue;
+  S21::intrusive_list<Job, &Job::by_owner> owner;
+  queue.push_back(a);
+  queue.push_back(b);
+  owner.push_front(a);
+  owner.push_front(b);
+  checkIds(queue, {1, 2});
+  checkIds(owner, {2, 1});
+  EXPECT_EQ(&*owner.iterator_to(a), &a);
+  queue.clear();
+}
@@ -1,8 +1,17 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <functional>
 #include <list>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
 
 #include "../s21_containers.h"
+#include "../s21_list_parallel_sort.h"
 
 TEST(ListTest, DefaultConstructor) {
   S21::List<int> l1;
@@ -893,3 +902,503 @@ TEST(ListTest, Iterator_Postfix_Decrement) {
   EXPECT_EQ(*tempIt, 3);
   EXPECT_EQ(*it, 2);
 }
+
+// Счётчик живых объектов для проверки работы пула узлов
+struct Tracked {
+  static int alive;
+  static int copies;
+  int value;
+  Tracked(int v = 0) : value(v) { ++alive; }
+  Tracked(const Tracked &other) : value(other.value) {
+    ++alive;
+    ++copies;
+  }
+  ~Tracked() { --alive; }
+  bool operator<(const Tracked &other) const { return value < other.value; }
+  bool operator<=(const Tracked &other) const {
+    return value <= other.value;
+  }
+  bool operator==(const Tracked &other) const {
+    return value == other.value;
+  }
+};
+int Tracked::alive = 0;
+int Tracked::copies = 0;
+
+TEST(ListPoolTest, FreedNodeIsReused) {
+  S21::List<int> list{1, 2, 3};
+  const int *last = &*--list.end();
+  list.pop_back();
+  list.push_back(4);
+  EXPECT_EQ(&*--list.end(), last);
+  EXPECT_EQ(list.back(), 4);
+}
+
+TEST(ListPoolTest, ClearDestroysEveryValue) {
+  int before = Tracked::alive;
+  {
+    S21::List<Tracked> list;
+    for (int i = 0; i < 100; ++i) list.push_back(Tracked(i));
+    list.erase(list.begin());
+    list.pop_front();
+    EXPECT_EQ(Tracked::alive - before, 98);
+    list.clear();
+    EXPECT_EQ(Tracked::alive - before, 0);
+    for (int i = 0; i < 10; ++i) list.push_front(Tracked(i));
+  }
+  EXPECT_EQ(Tracked::alive, before);
+}
+
+TEST(ListPoolTest, SplicedNodesOutliveSource) {
+  S21::List<int> target{1, 2};
+  {
+    S21::List<int> source;
+    for (int i = 0; i < 1000; ++i) source.push_back(i);
+    target.splice(target.end(), source);
+    source.push_back(-1);
+    source.clear();
+  }
+  EXPECT_EQ(target.size(), 1002u);
+  int sum = 0;
+  for (auto it = target.begin(); it != target.end(); ++it) sum += *it;
+  EXPECT_EQ(sum, 3 + 999 * 1000 / 2);
+  target.clear();
+  EXPECT_TRUE(target.empty());
+}
+
+TEST(ListPoolTest, PartialSpliceSharesPool) {
+  S21::List<int> target{1};
+  S21::List<int> source{2, 3};
+  target.splice(target.end(), source, source.begin());
+  // Узел, освобождённый в source, достаётся target: пул у них общий.
+  const int *freed = &source.front();
+  source.pop_front();
+  target.push_back(4);
+  EXPECT_EQ(&target.back(), freed);
+  EXPECT_TRUE(source.empty());
+  EXPECT_EQ(target.size(), 3u);
+}
+
+TEST(ListPoolTest, EmptiedListsLeaveSharedPool) {
+  S21::List<int> target{1};
+  S21::List<int> whole{2, 3};
+  S21::List<int> part{4, 5};
+  target.splice(target.end(), whole);
+  target.splice(target.end(), part, part.begin());
+  part.clear();
+  // whole и part больше не делят пул с target, их можно менять из других
+  // потоков.
+  std::thread first([&whole] {
+    for (int i = 0; i < 1000; ++i) whole.push_back(i);
+  });
+  std::thread second([&part] {
+    for (int i = 0; i < 1000; ++i) part.push_front(i);
+  });
+  for (int i = 0; i < 1000; ++i) target.push_back(i);
+  first.join();
+  second.join();
+  EXPECT_EQ(target.size(), 1004u);
+  EXPECT_EQ(whole.size(), 1000u);
+  EXPECT_EQ(part.size(), 1000u);
+}
+
+TEST(ListPoolTest, PopOnEmptyListIsNoop) {
+  S21::List<int> list;
+  list.pop_back();
+  list.pop_front();
+  EXPECT_TRUE(list.empty());
+}
+
+TEST(ListSortTest, RelinksNodesInsteadOfCopying) {
+  S21::List<int> list{5, 3, 4, 1, 2};
+  const int *five = &*list.begin();
+  list.sort();
+  EXPECT_EQ(&*--list.end(), five);
+  int expected = 1;
+  for (auto it = list.begin(); it != list.end(); ++it)
+    EXPECT_EQ(*it, expected++);
+  expected = 5;
+  for (auto it = --list.end(); it != list.end(); --it)
+    EXPECT_EQ(*it, expected--);
+}
+
+TEST(ListSortTest, StableWithComparator) {
+  S21::List<std::pair<int, int>> list;
+  for (int i = 0; i < 100; ++i) list.push_back({i % 7, i});
+  list.sort([](const std::pair<int, int> &a, const std::pair<int, int> &b) {
+    return a.first < b.first;
+  });
+  std::vector<std::pair<int, int>> expected;
+  for (int i = 0; i < 100; ++i) expected.push_back({i % 7, i});
+  std::stable_sort(
+      expected.begin(), expected.end(),
+      [](const std::pair<int, int> &a, const std::pair<int, int> &b) {
+        return a.first < b.first;
+      });
+  auto it = list.begin();
+  for (const auto &item : expected) EXPECT_EQ(*it++, item);
+}
+
+TEST(ListSortTest, SortedReversedAndEqualInputs) {
+  const int n = 100000;
+  S21::List<int> sorted, reversed, equal;
+  for (int i = 0; i < n; ++i) {
+    sorted.push_back(i);
+    reversed.push_front(i);
+    equal.push_back(7);
+  }
+  sorted.sort();
+  reversed.sort(std::greater<int>());
+  equal.sort();
+  int i = 0;
+  for (auto it = sorted.begin(); it != sorted.end(); ++it)
+    EXPECT_EQ(*it, i++);
+  i = n;
+  for (auto it = reversed.begin(); it != reversed.end(); ++it)
+    EXPECT_EQ(*it, --i);
+  EXPECT_EQ(equal.size(), static_cast<std::size_t>(n));
+  EXPECT_EQ(equal.back(), 7);
+}
+
+TEST(ListSortTest, ThrowingComparatorKeepsList) {
+  S21::List<std::string> list;
+  for (int i = 0; i < 1000; ++i)
+    list.push_back(std::to_string(i * 7919 % 1000));
+  auto values = [&list] {
+    std::vector<std::string> result;
+    for (auto it = list.begin(); it != list.end(); ++it) result.push_back(*it);
+    return result;
+  };
+  const std::vector<std::string> before = values();
+  int calls = 0;
+  auto throwing = [&calls](const std::string &a, const std::string &b) {
+    if (++calls == 3000) throw std::runtime_error("compare");
+    return a < b;
+  };
+  EXPECT_THROW(list.sort(throwing), std::runtime_error);
+  EXPECT_EQ(list.size(), before.size());
+  EXPECT_EQ(values(), before);
+  // Связи prev_ тоже целы
+  EXPECT_EQ(*--list.end(), before.back());
+  list.sort();
+  std::vector<std::string> sorted = values();
+  EXPECT_TRUE(std::is_sorted(sorted.begin(), sorted.end()));
+}
+
+TEST(ListSortTest, ParallelSortMatchesStableSort) {
+  const int n = 5 * S21::kParallelSortGrain + 123;
+  S21::List<std::pair<int, int>> list;
+  std::vector<std::pair<int, int>> expected;
+  unsigned seed = 1;
+  for (int i = 0; i < n; ++i) {
+    seed = seed * 1103515245 + 12345;
+    list.push_back({static_cast<int>(seed >> 16) % 1000, i});
+    expected.push_back(list.back());
+  }
+  auto by_first = [](const std::pair<int, int> &a,
+                     const std::pair<int, int> &b) {
+    return a.first < b.first;
+  };
+  S21::parallel_sort(list, 3, by_first);
+  std::stable_sort(expected.begin(), expected.end(), by_first);
+  ASSERT_EQ(list.size(), expected.size());
+  auto it = list.begin();
+  for (const auto &item : expected) EXPECT_EQ(*it++, item);
+  auto back = --list.end();
+  for (auto rit = expected.rbegin(); rit != expected.rend(); ++rit)
+    EXPECT_EQ(*back--, *rit);
+}
+
+TEST(ListSortTest, ParallelSortRelinksNodes) {
+  const int n = 4 * S21::kParallelSortGrain;
+  S21::List<Tracked> list;
+  for (int i = n; i > 0; --i) list.push_back(Tracked(i));
+  const Tracked *last = &list.front();
+  int copies = Tracked::copies;
+  S21::parallel_sort(list, 16);
+  EXPECT_EQ(Tracked::copies, copies);
+  EXPECT_EQ(&list.back(), last);
+  EXPECT_EQ(list.front().value, 1);
+  EXPECT_EQ(list.size(), static_cast<std::size_t>(n));
+}
+
+TEST(ListSortTest, ParallelSortSmallLists) {
+  S21::List<int> empty, small{3, 1, 2};
+  S21::parallel_sort(empty);
+  S21::parallel_sort(small, 8);
+  EXPECT_TRUE(empty.empty());
+  EXPECT_EQ(small.front(), 1);
+  EXPECT_EQ(small.back(), 3);
+}
+
+TEST(ListMergeTest, SplicesNodesWithoutCopies) {
+  S21::List<Tracked> list1, list2;
+  for (int i = 0; i < 1000; i += 2) {
+    list1.push_back(Tracked(i));
+    list2.push_back(Tracked(i + 1));
+  }
+  const Tracked *first_of_list2 = &*list2.begin();
+  int copies = Tracked::copies;
+  list1.merge(list2);
+  EXPECT_EQ(Tracked::copies, copies);
+  EXPECT_TRUE(list2.empty());
+  EXPECT_EQ(list1.size(), 1000u);
+  EXPECT_EQ(&*++list1.begin(), first_of_list2);
+  int expected = 0;
+  for (auto it = list1.begin(); it != list1.end(); ++it)
+    EXPECT_EQ((*it).value, expected++);
+}
+
+TEST(ListMergeTest, ThrowingComparatorKeepsSizes) {
+  S21::List<int> a{1, 3, 5, 7, 9};
+  S21::List<int> b{2, 4, 6, 8};
+  int calls = 0;
+  EXPECT_THROW(a.merge(b,
+                       [&calls](int x, int y) {
+                         if (++calls == 4) throw std::runtime_error("merge");
+                         return x < y;
+                       }),
+               std::runtime_error);
+  std::size_t count = 0;
+  for (auto it = a.begin(); it != a.end(); ++it) ++count;
+  EXPECT_EQ(a.size(), count);
+  count = 0;
+  for (auto it = b.begin(); it != b.end(); ++it) ++count;
+  EXPECT_EQ(b.size(), count);
+  EXPECT_EQ(a.size() + b.size(), 9u);
+  a.merge(b);
+  EXPECT_EQ(a.size(), 9u);
+  EXPECT_TRUE(b.empty());
+}
+
+TEST(ListMergeTest, StableWithComparator) {
+  S21::List<std::pair<int, char>> list1{{1, 'a'}, {3, 'a'}, {5, 'a'}};
+  S21::List<std::pair<int, char>> list2{{1, 'b'}, {4, 'b'}, {9, 'b'}};
+  list1.merge(list2, [](const std::pair<int, char> &a,
+                        const std::pair<int, char> &b) {
+    return a.first < b.first;
+  });
+  std::vector<std::pair<int, char>> expected = {
+      {1, 'a'}, {1, 'b'}, {3, 'a'}, {4, 'b'}, {5, 'a'}, {9, 'b'}};
+  auto it = list1.begin();
+  for (const auto &item : expected) EXPECT_EQ(*it++, item);
+  EXPECT_EQ(it, list1.end());
+}
+
+TEST(ListTest, ReverseKeepsNodes) {
+  S21::List<int> list{1, 2, 3, 4};
+  const int *one = &*list.begin();
+  list.reverse();
+  EXPECT_EQ(&*--list.end(), one);
+  std::vector<int> expected = {4, 3, 2, 1};
+  auto it = list.begin();
+  for (int value : expected) EXPECT_EQ(*it++, value);
+  for (int value : {1, 2, 3, 4}) EXPECT_EQ(*--it, value);
+}
+
+TEST(ListTest, UniqueWithPredicate) {
+  S21::List<int> list{1, 2, 4, 5, 9, 10, 11, 20};
+  list.unique([](int a, int b) { return b - a < 3; });
+  std::vector<int> expected = {1, 4, 9, 20};
+  EXPECT_EQ(list.size(), expected.size());
+  auto it = list.begin();
+  for (int value : expected) EXPECT_EQ(*it++, value);
+}
+
+TEST(ListTest, RemoveAndRemoveIf) {
+  S21::List<int> list{1, 2, 3, 2, 4, 2, 5};
+  EXPECT_EQ(list.remove(2), 3u);
+  EXPECT_EQ(list.remove_if([](int v) { return v % 2; }), 3u);
+  EXPECT_EQ(list.size(), 1u);
+  EXPECT_EQ(list.front(), 4);
+
+  S21::List<int> aliased{7, 1, 7, 7};
+  EXPECT_EQ(aliased.remove(aliased.front()), 3u);
+  EXPECT_EQ(aliased.size(), 1u);
+  EXPECT_EQ(aliased.front(), 1);
+}
+
+TEST(ListSpliceTest, SingleNodeFromOtherList) {
+  S21::List<int> list1{1, 2, 3};
+  S21::List<int> list2{10, 20, 30};
+  auto node = ++list2.begin();
+  const int *address = &*node;
+  list1.splice(list1.begin(), list2, node);
+  EXPECT_EQ(list1.size(), 4u);
+  EXPECT_EQ(list2.size(), 2u);
+  EXPECT_EQ(&*list1.begin(), address);
+  std::vector<int> expected1 = {20, 1, 2, 3};
+  std::vector<int> expected2 = {10, 30};
+  auto it1 = list1.begin();
+  for (int value : expected1) EXPECT_EQ(*it1++, value);
+  auto it2 = list2.begin();
+  for (int value : expected2) EXPECT_EQ(*it2++, value);
+}
+
+TEST(ListSpliceTest, MoveToFrontWithinList) {
+  S21::List<int> list{1, 2, 3, 4};
+  auto last = --list.end();
+  const int *address = &*last;
+  list.splice(list.begin(), list, last);
+  EXPECT_EQ(list.size(), 4u);
+  EXPECT_EQ(&*list.begin(), address);
+  list.splice(list.begin(), list, list.begin());
+  std::vector<int> expected = {4, 1, 2, 3};
+  auto it = list.begin();
+  for (int value : expected) EXPECT_EQ(*it++, value);
+  EXPECT_EQ(*--list.end(), 3);
+}
+
+TEST(ListSpliceTest, RangeFromOtherList) {
+  S21::List<int> list1{1, 2};
+  S21::List<int> list2{10, 20, 30, 40};
+  list1.splice(++list1.begin(), list2, ++list2.begin(), --list2.end());
+  EXPECT_EQ(list1.size(), 4u);
+  EXPECT_EQ(list2.size(), 2u);
+  std::vector<int> expected1 = {1, 20, 30, 2};
+  auto it = list1.begin();
+  for (int value : expected1) EXPECT_EQ(*it++, value);
+  EXPECT_EQ(list2.front(), 10);
+  EXPECT_EQ(list2.back(), 40);
+
+  list1.splice(list1.end(), list2, list2.begin(), list2.end(), 2);
+  EXPECT_EQ(list1.size(), 6u);
+  EXPECT_TRUE(list2.empty());
+  EXPECT_EQ(list1.back(), 40);
+}
+
+TEST(ListSpliceTest, RangeWithinList) {
+  S21::List<int> list{1, 2, 3, 4, 5};
+  list.splice(list.begin(), list, ++++list.begin(), list.end());
+  EXPECT_EQ(list.size(), 5u);
+  std::vector<int> expected = {3, 4, 5, 1, 2};
+  auto it = list.begin();
+  for (int value : expected) EXPECT_EQ(*it++, value);
+}
+
+// Тип без конструктора по умолчанию и без копирования
+struct MoveOnly {
+  explicit MoveOnly(int v) : value(std::make_unique<int>(v)) {}
+  std::unique_ptr<int> value;
+};
+
+TEST(ListEmplaceTest, EmptyListConstructsNoValues) {
+  int before = Tracked::alive;
+  S21::List<Tracked> list;
+  S21::List<Tracked> moved(std::move(list));
+  EXPECT_EQ(Tracked::alive, before);
+  EXPECT_TRUE(list.empty());
+  EXPECT_EQ(list.begin(), list.end());
+}
+
+TEST(ListEmplaceTest, EmplaceConstructsInPlace) {
+  S21::List<MoveOnly> list;
+  list.emplace_back(2);
+  list.emplace_front(1);
+  auto it = list.emplace(list.end(), 4);
+  list.emplace(it, 3);
+  EXPECT_EQ(list.size(), 4u);
+  int expected = 1;
+  for (auto i = list.begin(); i != list.end(); ++i)
+    EXPECT_EQ(*i->value, expected++);
+  EXPECT_EQ(*list.emplace_back(5).value, 5);
+}
+
+TEST(ListEmplaceTest, RvaluePushMoves) {
+  S21::List<MoveOnly> list;
+  MoveOnly item(7);
+  list.push_back(std::move(item));
+  list.push_front(MoveOnly(6));
+  list.insert(list.end(), MoveOnly(8));
+  EXPECT_EQ(item.value, nullptr);
+  EXPECT_EQ(*list.begin()->value, 6);
+  EXPECT_EQ(*(++list.begin())->value, 7);
+  EXPECT_EQ(*(--list.end())->value, 8);
+}
+
+TEST(ListEmplaceTest, MovedFromListIsReusable) {
+  S21::List<int> list1{1, 2, 3};
+  S21::List<int> list2(std::move(list1));
+  list1.push_back(4);
+  EXPECT_EQ(list1.size(), 1u);
+  EXPECT_EQ(list2.size(), 3u);
+  list1 = std::move(list2);
+  EXPECT_EQ(list1.size(), 3u);
+  EXPECT_TRUE(list2.empty());
+  list1.swap(list2);
+  EXPECT_TRUE(list1.empty());
+  EXPECT_EQ(list2.back(), 3);
+  EXPECT_EQ(*--list2.end(), 3);
+  EXPECT_EQ(list1.begin(), list1.end());
+}
+
+TEST(ListTraversalTest, ForEachAccumulateFindIf) {
+  S21::List<int> list;
+  for (int i = 1; i <= 100; ++i) list.push_back(i);
+  list.for_each([](int &value) { value *= 2; });
+  struct Counter {
+    int calls = 0;
+    void operator()(const int &) { ++calls; }
+  };
+  const S21::List<int> &view = list;
+  EXPECT_EQ(view.for_each(Counter()).calls, 100);
+  EXPECT_EQ(view.accumulate(0LL), 10100LL);
+  EXPECT_EQ(view.accumulate(0, [](int acc, int v) { return std::max(acc, v); }),
+            200);
+  auto found = list.find_if([](int v) { return v > 150; });
+  ASSERT_NE(found, list.end());
+  EXPECT_EQ(*found, 152);
+  EXPECT_EQ(view.find_if([](int v) { return v < 0; }), view.end());
+  S21::List<int> empty;
+  EXPECT_EQ(empty.accumulate(7), 7);
+  EXPECT_EQ(empty.find_if([](int) { return true; }), empty.end());
+}
+
+TEST(ListTraversalTest, RelayoutKeepsOrderAndPacksNodes) {
+  int before = Tracked::alive;
+  {
+    S21::List<Tracked> list;
+    for (int i = 0; i < 1000; ++i) list.push_back(Tracked((i * 7919) % 1000));
+    list.sort();
+    list.relayout();
+    EXPECT_EQ(Tracked::alive - before, 1000);
+    EXPECT_EQ(list.size(), 1000u);
+    int expected = 0;
+    for (auto it = list.begin(); it != list.end(); ++it)
+      EXPECT_EQ(it->value, expected++);
+    expected = 999;
+    for (auto it = --list.end(); it != list.end(); --it)
+      EXPECT_EQ(it->value, expected--);
+    // Первый блок пула целиком занят первыми узлами списка, подряд
+    auto it = list.begin();
+    const char *first = reinterpret_cast<const char *>(&*it++);
+    const char *second = reinterpret_cast<const char *>(&*it++);
+    const std::ptrdiff_t stride = second - first;
+    EXPECT_GT(stride, 0);
+    for (int i = 2; i < 16; ++i, ++it)
+      EXPECT_EQ(reinterpret_cast<const char *>(&*it) - first, stride * i);
+    list.push_back(Tracked(1000));
+    EXPECT_EQ(list.back().value, 1000);
+  }
+  EXPECT_EQ(Tracked::alive, before);
+}
+
+TEST(ListTraversalTest, RelayoutSharedPoolAndMoveOnly) {
+  S21::List<int> target, source{5, 6, 7};
+  target.splice(target.end(), source, source.begin());
+  target.push_back(1);
+  target.relayout();
+  source.push_back(8);
+  EXPECT_EQ(target.front(), 5);
+  EXPECT_EQ(target.back(), 1);
+  EXPECT_EQ(source.size(), 3u);
+  EXPECT_EQ(source.accumulate(0), 21);
+
+  S21::List<MoveOnly> values;
+  for (int i = 0; i < 3; ++i) values.emplace_back(i);
+  values.relayout();
+  int expected = 0;
+  values.for_each(
+      [&expected](MoveOnly &v) { EXPECT_EQ(*v.value, expected++); });
+  EXPECT_EQ(expected, 3);
+}
@@ -0,0 +1,111 @@
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "../s21_containersplus.h"
+
+template <class K, class V>
+std::vector<K> keysOf(const S21::lru_cache<K, V> &cache) {
+  std::vector<K> keys;
+  cache.for_each([&](const K &key, const V &) { keys.push_back(key); });
+  return keys;
+}
+
+TEST(LruCacheTest, GetPutAndCounters) {
+  S21::lru_cache<int, std::string> cache(3);
+  EXPECT_TRUE(cache.put(1, "one"));
+  EXPECT_TRUE(cache.put(2, "two"));
+  EXPECT_FALSE(cache.put(1, "uno"));
+  ASSERT_NE(cache.get(1), nullptr);
+  EXPECT_EQ(*cache.get(1), "uno");
+  EXPECT_EQ(cache.get(3), nullptr);
+  EXPECT_EQ(cache.size(), 2u);
+  EXPECT_EQ(cache.stats().hits, 2u);
+  EXPECT_EQ(cache.stats().misses, 1u);
+  cache.reset_stats();
+  EXPECT_EQ(cache.stats().hits, 0u);
+}
+
+TEST(LruCacheTest, EvictsLeastRecentlyUsed) {
+  S21::lru_cache<int, int> cache(3);
+  std::vector<std::pair<int, int>> evicted;
+  cache.set_eviction_callback(
+      [&](const int &key, int &value) { evicted.push_back({key, value}); });
+  cache.put(1, 10);
+  cache.put(2, 20);
+  cache.put(3, 30);
+  cache.get(1);
+  cache.touch(2);
+  cache.put(4, 40);
+  EXPECT_EQ(keysOf(cache), (std::vector<int>{4, 2, 1}));
+  ASSERT_EQ(evicted.size(), 1u);
+  EXPECT_EQ(evicted[0], std::make_pair(3, 30));
+  EXPECT_FALSE(cache.contains(3));
+  EXPECT_EQ(cache.stats().evictions, 1u);
+  EXPECT_EQ(*cache.peek(1), 10);
+  EXPECT_EQ(keysOf(cache), (std::vector<int>{4, 2, 1}));
+  cache.set_max_entries(1);
+  EXPECT_EQ(keysOf(cache), (std::vector<int>{4}));
+  EXPECT_EQ(evicted.size(), 3u);
+}
+
+TEST(LruCacheTest, CostLimit) {
+  S21::lru_cache<std::string, std::string> cache(
+      100, 10, [](const std::string &, const std::string &value) {
+        return value.size();
+      });
+  cache.put("a", "xxxx");
+  cache.put("b", "yyyy");
+  EXPECT_EQ(cache.cost(), 8u);
+  cache.put("c", "zzzz");
+  EXPECT_EQ(cache.cost(), 8u);
+  EXPECT_FALSE(cache.contains("a"));
+  cache.put("b", "y");
+  EXPECT_EQ(cache.cost(), 5u);
+  cache.put("huge", "0123456789abc");
+  EXPECT_FALSE(cache.contains("huge"));
+  EXPECT_TRUE(cache.contains("b"));
+  EXPECT_TRUE(cache.contains("c"));
+  EXPECT_EQ(cache.cost(), 5u);
+  cache.set_max_cost(4);
+  EXPECT_FALSE(cache.contains("c"));
+  EXPECT_EQ(cache.cost(), 1u);
+}
+
+TEST(LruCacheTest, ThrowingCostKeepsTotal) {
+  S21::lru_cache<int, int> cache(10, 100, [](const int &, const int &value) {
+    if (value < 0) throw std::invalid_argument("negative");
+    return static_cast<std::size_t>(value);
+  });
+  cache.put(1, 10);
+  cache.put(2, 20);
+  EXPECT_THROW(cache.put(1, -1), std::invalid_argument);
+  EXPECT_EQ(cache.cost(), 30u);
+  EXPECT_THROW(cache.put(3, -1), std::invalid_argument);
+  EXPECT_FALSE(cache.contains(3));
+  EXPECT_EQ(cache.size(), 2u);
+  cache.put(1, 5);
+  EXPECT_EQ(cache.cost(), 25u);
+  EXPECT_TRUE(cache.erase(1));
+  EXPECT_TRUE(cache.erase(2));
+  EXPECT_EQ(cache.cost(), 0u);
+}
+
+TEST(LruCacheTest, EraseAndClear) {
+  S21::lru_cache<int, int> cache(10);
+  int evictions = 0;
+  cache.set_eviction_callback([&](const int &, int &) { ++evictions; });
+  for (int i = 0; i < 5; ++i) cache.put(i, i);
+  EXPECT_TRUE(cache.erase(2));
+  EXPECT_FALSE(cache.erase(2));
+  EXPECT_EQ(cache.size(), 4u);
+  EXPECT_TRUE(cache.evict());
+  EXPECT_FALSE(cache.contains(0));
+  cache.clear();
+  EXPECT_TRUE(cache.empty());
+  EXPECT_EQ(cache.cost(), 0u);
+  EXPECT_FALSE(cache.evict());
+  EXPECT_EQ(evictions, 1);
+}
@@ -0,0 +1,72 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../s21_mpmc_queue.h"
+
+TEST(MpmcQueueTest, SingleThreadFifo) {
+  s21::mpmc_queue<std::string> queue(3);
+  EXPECT_EQ(queue.capacity(), 4u);
+  EXPECT_TRUE(queue.empty());
+  std::string value;
+  EXPECT_FALSE(queue.try_pop(value));
+  for (int round = 0; round < 5; ++round) {
+    for (int i = 0; i < 4; ++i) EXPECT_TRUE(queue.try_push(std::to_string(i)));
+    EXPECT_FALSE(queue.try_emplace(3, 'x'));
+    EXPECT_EQ(queue.size(), 4u);
+    EXPECT_EQ(queue.front(), "0");
+    for (int i = 0; i < 4; ++i) {
+      queue.pop(value);
+      EXPECT_EQ(value, std::to_string(i));
+    }
+    EXPECT_TRUE(queue.empty());
+  }
+}
+
+TEST(MpmcQueueTest, DestroysRemainingElements) {
+  auto counter = std::make_shared<int>(0);
+  {
+    s21::mpmc_queue<std::shared_ptr<int>> queue(8);
+    for (int i = 0; i < 5; ++i) queue.push(counter);
+    std::shared_ptr<int> out;
+    queue.pop(out);
+    EXPECT_EQ(counter.use_count(), 6);
+  }
+  EXPECT_EQ(counter.use_count(), 1);
+}
+
+TEST(MpmcQueueTest, ManyProducersManyConsumers) {
+  const int producers = 4, consumers = 3, per_producer = 20000;
+  s21::mpmc_queue<int> queue(64);
+  std::vector<std::atomic<int>> seen(producers * per_producer);
+  std::atomic<int> received{0};
+  std::vector<std::thread> threads;
+  for (int p = 0; p < producers; ++p)
+    threads.emplace_back([&queue, p] {
+      for (int i = 0; i < per_producer; ++i) queue.push(p * per_producer + i);
+    });
+  for (int c = 0; c < consumers; ++c)
+    threads.emplace_back([&] {
+      // Элементы одного производителя приходят каждому потребителю по порядку
+      std::vector<int> last(producers, -1);
+      int value;
+      while (received.load() < producers * per_producer) {
+        if (!queue.try_pop(value)) {
+          std::this_thread::yield();
+          continue;
+        }
+        ++received;
+        seen[value].fetch_add(1);
+        int producer = value / per_producer;
+        EXPECT_GT(value, last[producer]);
+        last[producer] = value;
+      }
+    });
+  for (auto &thread : threads) thread.join();
+  for (auto &count : seen) ASSERT_EQ(count.load(), 1);
+  EXPECT_TRUE(queue.empty());
+}
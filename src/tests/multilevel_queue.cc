@@ -0,0 +1,72 @@
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "../s21_multilevel_queue.h"
+
+TEST(MultilevelQueueTest, StrictPriorityAndFifoWithinLevel) {
+  s21::multilevel_queue<std::string, 4> queue;
+  EXPECT_TRUE(queue.empty());
+  EXPECT_THROW(queue.pop(), std::out_of_range);
+  EXPECT_THROW(queue.push(4, "x"), std::out_of_range);
+  queue.push(3, "low1");
+  queue.push(1, "mid1");
+  queue.emplace(3, "low2");
+  queue.push(1, std::string("mid2"));
+  EXPECT_EQ(queue.size(), 4u);
+  EXPECT_EQ(queue.top_level(), 1u);
+  std::vector<std::string> order;
+  while (!queue.empty()) {
+    order.push_back(queue.front());
+    queue.pop();
+  }
+  EXPECT_EQ(order,
+            (std::vector<std::string>{"mid1", "mid2", "low1", "low2"}));
+}
+
+TEST(MultilevelQueueTest, WeightedFairDequeue) {
+  s21::multilevel_queue<int, 3> queue;
+  queue.set_weight(0, 3);
+  queue.set_weight(2, 2);
+  EXPECT_THROW(queue.set_weight(1, 0), std::invalid_argument);
+  for (int i = 0; i < 6; ++i) {
+    queue.push(0, i);
+    queue.push(1, 10 + i);
+    queue.push(2, 20 + i);
+  }
+  std::vector<std::size_t> levels;
+  int value;
+  for (int i = 0; i < 12; ++i) levels.push_back(queue.pop_fair(value));
+  EXPECT_EQ(levels, (std::vector<std::size_t>{0, 0, 0, 1, 2, 2, 0, 0, 0, 1,
+                                              2, 2}));
+  EXPECT_EQ(value, 23);
+  // Опустевший уровень пропускается, остальные делят раунд
+  for (int i = 0; i < 6; ++i) queue.pop_fair(value);
+  EXPECT_EQ(queue.depth(0), 0u);
+  EXPECT_EQ(queue.depth(1), 0u);
+  EXPECT_EQ(queue.depth(2), 0u);
+  EXPECT_THROW(queue.pop_fair(value), std::out_of_range);
+}
+
+TEST(MultilevelQueueTest, DepthCounters) {
+  s21::multilevel_queue<std::unique_ptr<int>, 64> queue;
+  for (int i = 0; i < 5; ++i) queue.push(63, std::make_unique<int>(i));
+  queue.push(0, std::make_unique<int>(100));
+  queue.pop();
+  queue.pop();
+  const auto &low = queue.stats(63);
+  EXPECT_EQ(low.depth, 4u);
+  EXPECT_EQ(low.max_depth, 5u);
+  EXPECT_EQ(low.pushed, 5u);
+  EXPECT_EQ(low.popped, 1u);
+  EXPECT_EQ(queue.stats(0).popped, 1u);
+  EXPECT_EQ(*queue.front(), 1);
+  std::unique_ptr<int> out;
+  EXPECT_EQ(queue.pop(out), 63u);
+  EXPECT_EQ(*out, 1);
+  EXPECT_EQ(queue.pop_fair(out), 63u);
+  EXPECT_EQ(*out, 2);
+}
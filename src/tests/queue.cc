@@ -1,8 +1,14 @@
 #include <gtest/gtest.h>
 
+#include <iterator>
+#include <memory>
 #include <queue>
+#include <string>
+#include <type_traits>
+#include <vector>
 
 #include "../s21_containers.h"
+#include "../s21_ring_buffer.h"
 #ifdef ALPINE
 #define CORRECTION_FOR_TEST 2
 #else
@@ -148,6 +154,139 @@ TEST(swap, intQ) {
   ASSERT_EQ(true, checkEqQ(a, b));
   ASSERT_EQ(true, checkEqQ(c, d));
 }
+
+template <class T>
+using RingQueue = s21::queue<T, s21::ring_buffer<T>>;
+
+TEST(QueueRingTest, WrapsAroundAndGrowsInOrder) {
+  RingQueue<int> a;
+  std::queue<int> b;
+  int next = 0;
+  // Голова уходит вперёд, затем буфер растёт, пока занят с переносом
+  for (int round = 0; round < 50; ++round) {
+    for (int i = 0; i < 7; ++i) {
+      a.push(next);
+      b.push(next++);
+    }
+    for (int i = 0; i < 5; ++i) {
+      ASSERT_EQ(a.front(), b.front());
+      a.pop();
+      b.pop();
+    }
+    ASSERT_EQ(a.back(), b.back());
+  }
+  EXPECT_EQ(a.size(), b.size());
+  EXPECT_EQ(a.capacity() & (a.capacity() - 1), 0u);
+  EXPECT_GE(a.capacity(), a.size());
+  while (!b.empty()) {
+    ASSERT_EQ(a.front(), b.front());
+    a.pop();
+    b.pop();
+  }
+  EXPECT_TRUE(a.empty());
+  EXPECT_THROW(a.pop(), std::out_of_range);
+}
+
+TEST(QueueRingTest, CopyMoveAndReserve) {
+  RingQueue<std::string> a;
+  a.reserve(5);
+  EXPECT_EQ(a.capacity(), 8u);
+  for (int i = 0; i < 8; ++i) a.push(std::to_string(i));
+  a.pop();
+  a.pop();
+  a.push(a.front());
+  RingQueue<std::string> copy(a);
+  EXPECT_EQ(copy.size(), 7u);
+  EXPECT_EQ(copy.front(), "2");
+  EXPECT_EQ(copy.back(), "2");
+  RingQueue<std::string> moved;
+  moved = std::move(a);
+  EXPECT_TRUE(a.empty());
+  EXPECT_EQ(moved.front(), "2");
+  moved.pop();
+  moved.pop();
+  moved.pop();
+  moved.shrink_to_fit();
+  EXPECT_EQ(moved.capacity(), 4u);
+  EXPECT_EQ(moved.front(), "5");
+  EXPECT_EQ(moved.back(), "2");
+}
+
+TEST(QueueRingTest, DrainsLargeQueue) {
+  s21::queue<int> a;
+  for (int i = 0; i < 200000; ++i) a.push(i);
+  long long sum = 0;
+  while (!a.empty()) {
+    sum += a.front();
+    a.pop();
+  }
+  EXPECT_EQ(sum, 199999LL * 200000 / 2);
+}
+
+TEST(QueueAdapterTest, DequeByDefault) {
+  static_assert(std::is_same_v<s21::queue<int>::container_type,
+                               s21::deque<int>>);
+  s21::queue<std::string> a;
+  const std::vector<std::string> words{"a", "b", "c"};
+  a.push_range(words.begin(), words.end());
+  a.insert_many_back("d", "e");
+  a.push(a.front());
+  EXPECT_EQ(a.size(), 6u);
+  EXPECT_EQ(a.back(), "a");
+  a.pop();
+  a.shrink_to_fit();
+  EXPECT_EQ(a.front(), "b");
+}
+
+TEST(QueueAdapterTest, ListContainer) {
+  s21::queue<std::string, S21::List<std::string>> a({"a", "b"});
+  a.push("c");
+  s21::queue<std::string, S21::List<std::string>> b(a);
+  EXPECT_EQ(b.front(), "a");
+  EXPECT_EQ(b.back(), "c");
+  b.pop();
+  EXPECT_EQ(b.front(), "b");
+  EXPECT_EQ(a.size(), 3u);
+  s21::queue<std::string, S21::List<std::string>> c;
+  c = std::move(a);
+  EXPECT_TRUE(a.empty());
+  c.swap(b);
+  EXPECT_EQ(c.size(), 2u);
+  EXPECT_EQ(b.front(), "a");
+  while (!c.empty()) c.pop();
+  EXPECT_THROW(c.pop(), std::out_of_range);
+}
+
+TEST(QueueBatchTest, MoveOnlyElements) {
+  s21::queue<std::unique_ptr<int>> a;
+  a.push(std::make_unique<int>(1));
+  a.emplace(new int(2));
+  const int *front = a.front().get();
+  s21::queue<std::unique_ptr<int>> b(std::move(a));
+  EXPECT_EQ(b.front().get(), front);
+  a = std::move(b);
+  EXPECT_EQ(a.front().get(), front);
+  std::vector<std::unique_ptr<int>> out;
+  EXPECT_EQ(a.pop_n(1, std::back_inserter(out)), 1u);
+  EXPECT_EQ(*out[0], 1);
+  EXPECT_EQ(*a.front(), 2);
+}
+
+TEST(QueueBatchTest, RangeAndManyReserveOnce) {
+  RingQueue<int> a;
+  a.insert_many_back(1, 2, 3);
+  EXPECT_EQ(a.capacity(), 4u);
+  const std::vector<int> items{4, 5, 6, 7, 8, 9, 10, 11, 12};
+  a.push_range(items.begin(), items.end());
+  EXPECT_EQ(a.capacity(), 16u);
+  EXPECT_EQ(a.back(), 12);
+  std::vector<int> out;
+  EXPECT_EQ(a.pop_n(20, std::back_inserter(out)), 12u);
+  EXPECT_EQ(out.front(), 1);
+  EXPECT_EQ(out.back(), 12);
+  EXPECT_TRUE(a.empty());
+}
+
 // int main(int argc, char **argv)
 // {
 //     testing::InitGoogleTest(&argc, argv);
@@ -0,0 +1,71 @@
+#include <gtest/gtest.h>
+
+#include <deque>
+#include <memory>
+#include <string>
+
+#include "../s21_ring_buffer.h"
+
+TEST(RingBufferTest, BothEndsMatchDeque) {
+  s21::ring_buffer<int> buffer;
+  std::deque<int> expected;
+  for (int i = 0; i < 1000; ++i) {
+    buffer.push_back(i);
+    expected.push_back(i);
+    if (i % 3 == 0) {
+      buffer.pop_front();
+      expected.pop_front();
+    }
+    if (i % 5 == 0) {
+      buffer.pop_back();
+      expected.pop_back();
+    }
+  }
+  ASSERT_EQ(buffer.size(), expected.size());
+  for (std::size_t i = 0; i < expected.size(); ++i)
+    EXPECT_EQ(buffer[i], expected[i]);
+  EXPECT_EQ(buffer.front(), expected.front());
+  EXPECT_EQ(buffer.back(), expected.back());
+  EXPECT_EQ(buffer.capacity() & (buffer.capacity() - 1), 0u);
+}
+
+TEST(RingBufferTest, DestroysElementsAndHandlesMoveOnly) {
+  auto counter = std::make_shared<int>(0);
+  {
+    s21::ring_buffer<std::shared_ptr<int>> buffer;
+    for (int i = 0; i < 20; ++i) buffer.push_back(counter);
+    EXPECT_EQ(counter.use_count(), 21);
+    buffer.pop_front();
+    buffer.pop_back();
+    EXPECT_EQ(counter.use_count(), 19);
+    buffer.clear();
+    EXPECT_EQ(counter.use_count(), 1);
+    buffer.push_back(counter);
+  }
+  EXPECT_EQ(counter.use_count(), 1);
+
+  s21::ring_buffer<std::unique_ptr<int>> owners;
+  for (int i = 0; i < 10; ++i) owners.emplace_back(std::make_unique<int>(i));
+  s21::ring_buffer<std::unique_ptr<int>> moved(std::move(owners));
+  EXPECT_TRUE(owners.empty());
+  EXPECT_EQ(*moved.front(), 0);
+  EXPECT_EQ(*moved.back(), 9);
+}
+
+TEST(RingBufferTest, CopyAndAliasingPush) {
+  s21::ring_buffer<std::string> buffer{"a", "b", "c", "d", "e", "f", "g",
+                                       "h"};
+  EXPECT_EQ(buffer.capacity(), 8u);
+  buffer.push_back(buffer.front());
+  EXPECT_EQ(buffer.capacity(), 16u);
+  EXPECT_EQ(buffer.back(), "a");
+  s21::ring_buffer<std::string> copy;
+  copy = buffer;
+  EXPECT_EQ(copy.size(), 9u);
+  EXPECT_EQ(copy[8], "a");
+  copy.shrink_to_fit();
+  EXPECT_EQ(copy.capacity(), 16u);
+  while (copy.size() > 1) copy.pop_front();
+  EXPECT_LE(copy.capacity(), 8u);
+  EXPECT_EQ(copy.front(), "a");
+}
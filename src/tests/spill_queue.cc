@@ -0,0 +1,185 @@
+#include <gtest/gtest.h>
+#include <sys/resource.h>
+
+#include <csignal>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+
+#include "../s21_spill_queue.h"
+
+namespace {
+struct Record {
+  int id;
+  double weight;
+};
+
+std::size_t segmentFiles(const std::string &directory) {
+  std::size_t count = 0;
+  for (const auto &entry : std::filesystem::directory_iterator(directory))
+    if (entry.path().filename().string().rfind("s21_spill_", 0) == 0)
+      ++count;
+  return count;
+}
+
+// Первый по имени сегмент: в тестах номера сегментов однозначные.
+std::filesystem::path firstSegment(const std::string &directory) {
+  std::filesystem::path first;
+  for (const auto &entry : std::filesystem::directory_iterator(directory))
+    if (entry.path().filename().string().rfind("s21_spill_", 0) == 0 &&
+        (first.empty() || entry.path() < first))
+      first = entry.path();
+  return first;
+}
+
+class SpillQueueTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    directory_ = (std::filesystem::path(::testing::TempDir()) /
+                  "s21_spill_queue_test")
+                     .string();
+    std::filesystem::remove_all(directory_);
+    std::filesystem::create_directories(directory_);
+  }
+  void TearDown() override { std::filesystem::remove_all(directory_); }
+
+  std::string directory_;
+};
+}  // namespace
+
+TEST_F(SpillQueueTest, StaysInMemoryWhileSmall) {
+  s21::spill_queue<int> queue(directory_, 16, 64);
+  EXPECT_THROW(queue.pop(), std::out_of_range);
+  for (int i = 0; i < 16; ++i) queue.push(i);
+  EXPECT_EQ(queue.spilled(), 0u);
+  EXPECT_EQ(segmentFiles(directory_), 0u);
+  EXPECT_EQ(queue.front(), 0);
+  EXPECT_EQ(queue.size(), 16u);
+}
+
+TEST_F(SpillQueueTest, SpillsAndReadsBackInOrder) {
+  {
+    s21::spill_queue<Record> queue(directory_, 16, 40);
+    for (int i = 0; i < 1000; ++i) queue.push(Record{i, i * 0.5});
+    EXPECT_EQ(queue.size(), 1000u);
+    EXPECT_GT(queue.spilled(), 900u);
+    EXPECT_EQ(segmentFiles(directory_), 25u);
+    for (int i = 0; i < 500; ++i) {
+      ASSERT_EQ(queue.front().id, i);
+      queue.pop();
+    }
+    EXPECT_LT(segmentFiles(directory_), 25u);
+  }
+  // Разрушение очереди убирает оставшиеся сегменты
+  EXPECT_EQ(segmentFiles(directory_), 0u);
+}
+
+TEST_F(SpillQueueTest, InterleavedPushPop) {
+  s21::spill_queue<long long> queue(directory_, 8, 8);
+  long long next_in = 0, next_out = 0;
+  for (int round = 0; round < 200; ++round) {
+    for (int i = 0; i < round % 17 + 1; ++i) queue.push(next_in++);
+    for (int i = 0; i < round % 13 && !queue.empty(); ++i) {
+      ASSERT_EQ(queue.front(), next_out++);
+      queue.pop();
+    }
+  }
+  while (!queue.empty()) {
+    ASSERT_EQ(queue.front(), next_out++);
+    queue.pop();
+  }
+  EXPECT_EQ(next_out, next_in);
+  EXPECT_EQ(segmentFiles(directory_), 0u);
+}
+
+TEST_F(SpillQueueTest, MissingDirectoryThrows) {
+  s21::spill_queue<int> queue(directory_ + "/missing", 4, 4);
+  for (int i = 0; i < 4; ++i) queue.push(i);
+  queue.push(4);
+  // Неудачный push ничего не меняет, и его можно повторить.
+  EXPECT_THROW(queue.push(5), std::runtime_error);
+  EXPECT_EQ(queue.size(), 5u);
+  std::filesystem::create_directories(directory_ + "/missing");
+  queue.push(5);
+  EXPECT_EQ(queue.size(), 6u);
+  EXPECT_EQ(queue.spilled(), 2u);
+  for (int i = 0; i < 6; ++i) {
+    EXPECT_EQ(queue.front(), i);
+    queue.pop();
+  }
+  EXPECT_TRUE(queue.empty());
+}
+
+TEST_F(SpillQueueTest, ShortWriteKeepsOrder) {
+  s21::spill_queue<int> queue(directory_, 4, 1000);
+  for (int i = 0; i < 6; ++i) queue.push(i);
+  // Файлам разрешено 10 байт: вторая пачка из двух int записывается лишь
+  // наполовину.
+  rlimit saved;
+  ASSERT_EQ(getrlimit(RLIMIT_FSIZE, &saved), 0);
+  auto old_handler = std::signal(SIGXFSZ, SIG_IGN);
+  rlimit limit = saved;
+  limit.rlim_cur = 10;
+  ASSERT_EQ(setrlimit(RLIMIT_FSIZE, &limit), 0);
+  queue.push(6);
+  EXPECT_THROW(queue.push(7), std::runtime_error);
+  setrlimit(RLIMIT_FSIZE, &saved);
+  std::signal(SIGXFSZ, old_handler);
+  EXPECT_EQ(queue.size(), 7u);
+  for (int i = 7; i < 12; ++i) queue.push(i);
+  for (int i = 0; i < 12; ++i) {
+    EXPECT_EQ(queue.front(), i);
+    queue.pop();
+  }
+  EXPECT_TRUE(queue.empty());
+}
+
+TEST_F(SpillQueueTest, QueuesInOneDirectoryUseDistinctFiles) {
+  s21::spill_queue<int> ints(directory_, 2, 2);
+  s21::spill_queue<double> doubles(directory_, 2, 2);
+  for (int i = 0; i < 10; ++i) {
+    ints.push(i);
+    doubles.push(i + 0.5);
+  }
+  EXPECT_EQ(segmentFiles(directory_), 8u);
+  for (int i = 0; i < 10; ++i) {
+    EXPECT_EQ(ints.front(), i);
+    EXPECT_EQ(doubles.front(), i + 0.5);
+    ints.pop();
+    doubles.pop();
+  }
+  EXPECT_EQ(segmentFiles(directory_), 0u);
+}
+
+TEST_F(SpillQueueTest, FailedReadKeepsQueue) {
+  s21::spill_queue<int> queue(directory_, 4, 4);
+  for (int i = 0; i < 14; ++i) queue.push(i);
+  const std::filesystem::path segment = firstSegment(directory_);
+  std::string bytes;
+  {
+    std::ifstream in(segment, std::ios::binary);
+    bytes.assign(std::istreambuf_iterator<char>(in), {});
+  }
+  std::filesystem::resize_file(segment, 0);
+  queue.pop();
+  queue.pop();
+  // Упреждающее чтение не удалось, но элемент снят.
+  queue.pop();
+  EXPECT_EQ(queue.size(), 11u);
+  EXPECT_EQ(queue.front(), 3);
+  queue.pop();
+  EXPECT_THROW(queue.front(), std::runtime_error);
+  EXPECT_THROW(queue.pop(), std::runtime_error);
+  EXPECT_EQ(queue.size(), 10u);
+  {
+    std::ofstream out(segment, std::ios::binary | std::ios::trunc);
+    out << bytes;
+  }
+  for (int i = 4; i < 14; ++i) {
+    ASSERT_EQ(queue.front(), i);
+    queue.pop();
+  }
+  EXPECT_TRUE(queue.empty());
+}
@@ -0,0 +1,107 @@
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../s21_spsc_queue.h"
+
+TEST(SpscQueueTest, FifoAndCapacity) {
+  s21::spsc_queue<std::string> queue(5);
+  EXPECT_EQ(queue.capacity(), 8u);
+  EXPECT_TRUE(queue.empty());
+  for (int round = 0; round < 3; ++round) {
+    for (int i = 0; i < 8; ++i) EXPECT_TRUE(queue.try_push(std::to_string(i)));
+    EXPECT_FALSE(queue.try_push("full"));
+    EXPECT_EQ(queue.size(), 8u);
+    std::string value;
+    for (int i = 0; i < 5; ++i) {
+      ASSERT_TRUE(queue.try_pop(value));
+      EXPECT_EQ(value, std::to_string(i));
+    }
+    EXPECT_TRUE(queue.try_emplace(2, 'x'));
+    for (int i = 5; i < 8; ++i) {
+      ASSERT_TRUE(queue.try_pop(value));
+      EXPECT_EQ(value, std::to_string(i));
+    }
+    queue.pop(value);
+    EXPECT_EQ(value, "xx");
+    EXPECT_FALSE(queue.try_pop(value));
+  }
+}
+
+TEST(SpscQueueTest, BatchOperations) {
+  s21::spsc_queue<int> queue(16);
+  std::vector<int> input(20);
+  for (int i = 0; i < 20; ++i) input[i] = i;
+  EXPECT_EQ(queue.push_n(input.begin(), 20), 16u);
+  EXPECT_EQ(queue.push_n(input.begin(), 1), 0u);
+  std::vector<int> output(10, -1);
+  EXPECT_EQ(queue.pop_n(output.begin(), 10), 10u);
+  for (int i = 0; i < 10; ++i) EXPECT_EQ(output[i], i);
+  EXPECT_EQ(queue.push_n(input.begin() + 16, 4), 4u);
+  std::vector<int> rest;
+  EXPECT_EQ(queue.pop_n(std::back_inserter(rest), 100), 10u);
+  ASSERT_EQ(rest.size(), 10u);
+  EXPECT_EQ(rest.front(), 10);
+  EXPECT_EQ(rest.back(), 19);
+  EXPECT_EQ(queue.pop_n(rest.begin(), 5), 0u);
+}
+
+TEST(SpscQueueTest, DestroysRemainingAndMovesOnly) {
+  auto counter = std::make_shared<int>(0);
+  {
+    s21::spsc_queue<std::shared_ptr<int>> queue(4);
+    for (int i = 0; i < 3; ++i) queue.push(counter);
+    std::shared_ptr<int> out;
+    queue.pop(out);
+    out.reset();
+    EXPECT_EQ(counter.use_count(), 3);
+  }
+  EXPECT_EQ(counter.use_count(), 1);
+  s21::spsc_queue<std::unique_ptr<int>> owners(2);
+  owners.push(std::make_unique<int>(7));
+  std::unique_ptr<int> out;
+  EXPECT_TRUE(owners.try_pop(out));
+  EXPECT_EQ(*out, 7);
+}
+
+TEST(SpscQueueTest, TwoThreadsKeepOrder) {
+  const int n = 200000;
+  s21::spsc_queue<int> queue(64);
+  std::thread producer([&queue] {
+    int batch[8];
+    s21::spin_wait waiter;
+    for (int i = 0; i < n;) {
+      if (i % 3 == 0) {
+        int count = 0;
+        for (; count < 8 && i + count < n; ++count) batch[count] = i + count;
+        std::size_t pushed = queue.push_n(batch, count);
+        if (!pushed) waiter.wait();
+        i += static_cast<int>(pushed);
+      } else {
+        queue.push(i++);
+      }
+    }
+  });
+  int expected = 0;
+  bool ordered = true;
+  s21::spin_wait waiter;
+  while (expected < n) {
+    int value;
+    if (expected % 5 == 0) {
+      int batch[16];
+      std::size_t count = queue.pop_n(batch, 16);
+      if (!count) waiter.wait();
+      for (std::size_t i = 0; i < count; ++i)
+        ordered = ordered && batch[i] == expected++;
+    } else {
+      queue.pop(value);
+      ordered = ordered && value == expected++;
+    }
+  }
+  producer.join();
+  EXPECT_TRUE(ordered);
+  EXPECT_TRUE(queue.empty());
+}
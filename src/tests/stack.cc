@@ -1,8 +1,15 @@
 #include <gtest/gtest.h>
 
+#include <iterator>
+#include <memory>
 #include <stack>
+#include <string>
+#include <type_traits>
+#include <vector>
 
 #include "../s21_containers.h"
+#include "../s21_deque.h"
+#include "../s21_ring_buffer.h"
 #ifdef ALPINE
 #define CORRECTION_FOR_TEST 2
 #else
@@ -145,6 +152,164 @@ TEST(swap, int) {
   ASSERT_EQ(true, checkEq(c, d));
 }
 
+TEST(StackCapacityTest, GrowsGeometrically) {
+  s21::stack<int> a;
+  std::size_t reallocations = 0, capacity = a.capacity();
+  for (int i = 0; i < 100000; ++i) {
+    a.push(i);
+    if (a.capacity() != capacity) {
+      ++reallocations;
+      capacity = a.capacity();
+    }
+  }
+  EXPECT_LE(reallocations, 20u);
+  EXPECT_LT(a.capacity(), 2 * a.size());
+  EXPECT_EQ(a.top(), 99999);
+}
+
+TEST(StackCapacityTest, ShrinksWithHysteresis) {
+  s21::stack<int, s21::ring_buffer<int>> a;
+  for (int i = 0; i < 1024; ++i) a.push(i);
+  const std::size_t full = a.capacity();
+  while (a.size() > full / 4) a.pop();
+  EXPECT_EQ(a.capacity(), full);
+  a.pop();
+  EXPECT_EQ(a.capacity(), full / 2);
+  for (int i = 0; i < 10; ++i) {
+    a.push(i);
+    a.pop();
+  }
+  EXPECT_EQ(a.capacity(), full / 2);
+  EXPECT_EQ(a.top(), static_cast<int>(full / 4) - 2);
+}
+
+TEST(StackCapacityTest, ReserveAndShrinkToFit) {
+  s21::stack<std::string, s21::ring_buffer<std::string>> a;
+  a.reserve(100);
+  EXPECT_EQ(a.capacity(), 128u);
+  for (int i = 0; i < 8; ++i) a.push(std::to_string(i));
+  a.reserve(10);
+  EXPECT_EQ(a.capacity(), 128u);
+  while (a.size() > 5) a.pop();
+  a.shrink_to_fit();
+  EXPECT_EQ(a.capacity(), 8u);
+  a.push(a.top());
+  a.push(a.top());
+  a.push(a.top());
+  EXPECT_EQ(a.top(), "4");
+  EXPECT_EQ(a.size(), 8u);
+  a.push(a.top());
+  EXPECT_EQ(a.capacity(), 16u);
+  EXPECT_EQ(a.top(), "4");
+  while (!a.empty()) a.pop();
+  a.shrink_to_fit();
+  EXPECT_EQ(a.capacity(), 0u);
+  EXPECT_THROW(a.pop(), std::out_of_range);
+}
+
+TEST(StackCapacityTest, MoveAssignment) {
+  s21::stack<int> a({1, 2, 3});
+  s21::stack<int> b;
+  b = std::move(a);
+  EXPECT_EQ(b.size(), 3u);
+  EXPECT_EQ(b.top(), 3);
+  EXPECT_TRUE(a.empty());
+}
+
+TEST(StackCapacityTest, VectorByDefault) {
+  static_assert(std::is_same_v<s21::stack<int>::container_type,
+                               s21::Vector<int>>);
+  s21::stack<std::string> a;
+  a.reserve(2);
+  a.push(std::string(32, 'a'));
+  a.push(std::string(32, 'b'));
+  // Вершина копируется до перевыделения, на которое указывает её ссылка.
+  a.push(a.top());
+  EXPECT_EQ(a.capacity(), 4u);
+  EXPECT_EQ(a.top(), std::string(32, 'b'));
+  a.emplace(a.top());
+  EXPECT_EQ(a.size(), 4u);
+  EXPECT_EQ(a.top(), std::string(32, 'b'));
+  auto shared = std::make_shared<int>(1);
+  s21::stack<std::shared_ptr<int>> b;
+  b.push(shared);
+  b.pop();
+  // Снятый элемент отпускает то, чем владел.
+  EXPECT_EQ(shared.use_count(), 1);
+}
+
+template <class Container>
+void checkAdapter() {
+  s21::stack<int, Container> a({1, 2, 3});
+  a.push(4);
+  s21::stack<int, Container> b(a);
+  EXPECT_EQ(b.top(), 4);
+  b.pop();
+  EXPECT_EQ(b.top(), 3);
+  EXPECT_EQ(a.size(), 4u);
+  s21::stack<int, Container> c(std::move(a));
+  EXPECT_TRUE(a.empty());
+  c.swap(b);
+  EXPECT_EQ(c.size(), 3u);
+  EXPECT_EQ(b.top(), 4);
+  while (!c.empty()) c.pop();
+  EXPECT_THROW(c.pop(), std::out_of_range);
+}
+
+TEST(StackAdapterTest, Containers) {
+  checkAdapter<s21::deque<int>>();
+  checkAdapter<s21::ring_buffer<int>>();
+  checkAdapter<s21::Vector<int>>();
+  checkAdapter<S21::List<int>>();
+}
+
+TEST(StackAdapterTest, FromContainer) {
+  s21::Vector<int> items{1, 2, 3};
+  s21::stack<int, s21::Vector<int>> a(items);
+  a.reserve(100);
+  EXPECT_EQ(a.capacity(), 100u);
+  EXPECT_EQ(a.top(), 3);
+  s21::stack<int, S21::List<int>> b(S21::List<int>{7, 8});
+  EXPECT_EQ(b.top(), 8);
+  EXPECT_EQ(b.size(), 2u);
+}
+
+TEST(StackBatchTest, MoveOnlyElements) {
+  s21::stack<std::unique_ptr<int>> a;
+  a.push(std::make_unique<int>(1));
+  a.emplace(new int(2));
+  EXPECT_EQ(*a.top(), 2);
+  const int *top = a.top().get();
+  s21::stack<std::unique_ptr<int>> b(std::move(a));
+  EXPECT_EQ(b.top().get(), top);
+  a = std::move(b);
+  EXPECT_EQ(a.top().get(), top);
+  std::vector<std::unique_ptr<int>> out;
+  EXPECT_EQ(a.pop_n(5, std::back_inserter(out)), 2u);
+  EXPECT_EQ(*out[0], 2);
+  EXPECT_EQ(*out[1], 1);
+  EXPECT_TRUE(a.empty());
+}
+
+TEST(StackBatchTest, RangeAndManyReserveOnce) {
+  s21::stack<int, s21::Vector<int>> a;
+  a.insert_many_back(1, 2, 3);
+  EXPECT_EQ(a.capacity(), 3u);
+  const std::vector<int> items{4, 5, 6, 7, 8};
+  a.push_range(items.begin(), items.end());
+  EXPECT_EQ(a.capacity(), 8u);
+  EXPECT_EQ(a.top(), 8);
+  std::vector<int> out(3);
+  EXPECT_EQ(a.pop_n(3, out.begin()), 3u);
+  EXPECT_EQ(out, (std::vector<int>{8, 7, 6}));
+  const std::vector<std::string> words{"a", "b"};
+  s21::stack<std::string> b;
+  b.push_range(words.begin(), words.end());
+  b.emplace(3, 'x');
+  EXPECT_EQ(b.top(), "xxx");
+  EXPECT_EQ(b.size(), 3u);
+}
+
 // int main(int argc, char **argv)
 // {
 //     testing::InitGoogleTest(&argc, argv);
@@ -0,0 +1,171 @@
+#include <gtest/gtest.h>
+
+#include <initializer_list>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "../s21_containersplus.h"
+
+template <class T, std::size_t N>
+void checkEqStaticVector(const s21::static_vector<T, N> &a,
+                         const std::vector<T> &b) {
+  ASSERT_EQ(a.size(), b.size());
+  for (std::size_t i = 0; i < a.size(); i++) EXPECT_EQ(a[i], b[i]);
+}
+
+TEST(StaticVectorTest, InlineStorage) {
+  s21::static_vector<int, 8> v{1, 2, 3};
+  const char *self = reinterpret_cast<const char *>(&v);
+  const char *first = reinterpret_cast<const char *>(v.data());
+  EXPECT_TRUE(first >= self && first < self + sizeof(v));
+  EXPECT_EQ(v.capacity(), 8u);
+  EXPECT_EQ(v.max_size(), 8u);
+}
+
+TEST(StaticVectorTest, Constructors) {
+  s21::static_vector<int, 4> a;
+  EXPECT_TRUE(a.empty());
+  s21::static_vector<int, 4> b(3);
+  checkEqStaticVector(b, std::vector<int>(3));
+  s21::static_vector<std::string, 4> c{"a", "b"};
+  s21::static_vector<std::string, 4> d(c);
+  checkEqStaticVector(d, std::vector<std::string>{"a", "b"});
+  s21::static_vector<std::string, 4> e(std::move(d));
+  checkEqStaticVector(e, std::vector<std::string>{"a", "b"});
+  EXPECT_TRUE(d.empty());
+  EXPECT_THROW((s21::static_vector<int, 2>{1, 2, 3}), std::length_error);
+  EXPECT_THROW((s21::static_vector<int, 2>(3)), std::length_error);
+}
+
+TEST(StaticVectorTest, Assignment) {
+  s21::static_vector<std::string, 4> a{"x", "y", "z"};
+  s21::static_vector<std::string, 4> b{"q"};
+  b = a;
+  checkEqStaticVector(b, std::vector<std::string>{"x", "y", "z"});
+  s21::static_vector<std::string, 4> c;
+  c = std::move(b);
+  checkEqStaticVector(c, std::vector<std::string>{"x", "y", "z"});
+  EXPECT_TRUE(b.empty());
+}
+
+TEST(StaticVectorTest, ElementAccess) {
+  s21::static_vector<int, 4> v;
+  EXPECT_THROW(v.front(), std::out_of_range);
+  EXPECT_THROW(v.back(), std::out_of_range);
+  v.push_back(1);
+  v.push_back(2);
+  EXPECT_EQ(v.at(1), 2);
+  EXPECT_THROW(v.at(2), std::out_of_range);
+  EXPECT_EQ(v.front(), 1);
+  EXPECT_EQ(v.back(), 2);
+  const s21::static_vector<int, 4> &c = v;
+  EXPECT_EQ(c.at(0), 1);
+  EXPECT_THROW(c.at(2), std::out_of_range);
+}
+
+TEST(StaticVectorTest, PushPopOverflow) {
+  s21::static_vector<int, 3> v;
+  v.push_back(1);
+  v.push_back(2);
+  v.emplace_back(3);
+  EXPECT_THROW(v.push_back(4), std::length_error);
+  EXPECT_EQ(v.size(), 3u);
+  v.pop_back();
+  checkEqStaticVector(v, std::vector<int>{1, 2});
+  EXPECT_THROW(v.reserve(4), std::length_error);
+  v.clear();
+  EXPECT_TRUE(v.empty());
+}
+
+TEST(StaticVectorTest, InsertErase) {
+  s21::static_vector<int, 8> v{1, 2, 3};
+  std::vector<int> s{1, 2, 3};
+  auto it = v.insert(v.begin() + 1, 9);
+  s.insert(s.begin() + 1, 9);
+  EXPECT_EQ(*it, 9);
+  checkEqStaticVector(v, s);
+  v.erase(v.begin());
+  s.erase(s.begin());
+  checkEqStaticVector(v, s);
+  EXPECT_THROW(v.erase(v.end()), std::out_of_range);
+  EXPECT_THROW(v.insert(v.end() + 1, 0), std::out_of_range);
+}
+
+TEST(StaticVectorTest, InsertMany) {
+  s21::static_vector<int, 8> v{1, 2, 3, 4};
+  std::vector<int> s{1, 2, 3, 4};
+  v.insert_many(v.cbegin() + 1, 6, 7, 8);
+  s.insert(s.cbegin() + 1, {6, 7, 8});
+  checkEqStaticVector(v, s);
+  v.insert_many_back(9);
+  s.push_back(9);
+  checkEqStaticVector(v, s);
+  EXPECT_THROW(v.insert_many_back(10, 11, 12), std::length_error);
+  checkEqStaticVector(v, s);
+  EXPECT_EQ(v.insert_many(v.cbegin()), v.begin());
+  EXPECT_EQ(v.insert_many(v.cend()), v.end());
+  checkEqStaticVector(v, s);
+}
+
+TEST(StaticVectorTest, NothrowMove) {
+  using Strings = s21::static_vector<std::string, 4>;
+  static_assert(std::is_nothrow_move_constructible_v<Strings>);
+  static_assert(std::is_nothrow_move_assignable_v<Strings>);
+  std::vector<Strings> vectors(1, Strings{std::string(32, 'a')});
+  const char *first = vectors[0][0].data();
+  vectors.resize(vectors.capacity() + 1);
+  // При росте std::vector строки перенесены, а не скопированы
+  EXPECT_EQ(vectors[0][0].data(), first);
+}
+
+namespace {
+// Бросает на создании с номером throw_at и считает живые объекты.
+struct Fragile {
+  static int alive;
+  static int built;
+  static int throw_at;
+  Fragile() { build(); }
+  Fragile(int) { build(); }
+  Fragile(const Fragile &) { build(); }
+  ~Fragile() { --alive; }
+  static void build() {
+    if (++built == throw_at) throw std::runtime_error("fragile");
+    ++alive;
+  }
+  static void throwAt(int n) {
+    built = 0;
+    throw_at = n;
+  }
+};
+int Fragile::alive = 0;
+int Fragile::built = 0;
+int Fragile::throw_at = 0;
+}  // namespace
+
+TEST(StaticVectorTest, ThrowingConstructorsDestroyBuilt) {
+  using Fragiles = s21::static_vector<Fragile, 4>;
+  Fragile::throwAt(3);
+  EXPECT_THROW(Fragiles(4), std::runtime_error);
+  EXPECT_EQ(Fragile::alive, 0);
+  {
+    const std::initializer_list<Fragile> items{1, 2, 3, 4};
+    Fragile::throwAt(3);
+    EXPECT_THROW(Fragiles{items}, std::runtime_error);
+    EXPECT_EQ(Fragile::alive, 4);
+    Fragile::throwAt(0);
+    Fragiles two(2);
+    Fragile::throwAt(2);
+    EXPECT_THROW(Fragiles copy(two), std::runtime_error);
+    EXPECT_EQ(Fragile::alive, 6);
+  }
+  EXPECT_EQ(Fragile::alive, 0);
+}
+
+TEST(StaticVectorTest, Swap) {
+  s21::static_vector<std::string, 4> a{"a"};
+  s21::static_vector<std::string, 4> b{"b", "c"};
+  a.swap(b);
+  checkEqStaticVector(a, std::vector<std::string>{"b", "c"});
+  checkEqStaticVector(b, std::vector<std::string>{"a"});
+}
@@ -0,0 +1,71 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "../s21_thread_pool.h"
+
+namespace {
+long long fib(s21::thread_pool &pool, int n) {
+  if (n < 12) return n < 2 ? n : fib(pool, n - 1) + fib(pool, n - 2);
+  long long a = 0, b = 0;
+  pool.parallel_invoke([&] { a = fib(pool, n - 1); },
+                       [&] { b = fib(pool, n - 2); });
+  return a + b;
+}
+}  // namespace
+
+TEST(ThreadPoolTest, InvokesEveryFunction) {
+  s21::thread_pool pool(3);
+  EXPECT_EQ(pool.size(), 3u);
+  std::atomic<int> calls{0};
+  std::vector<int> results(4);
+  for (int round = 0; round < 100; ++round)
+    pool.parallel_invoke([&] { results[0] = ++calls; },
+                         [&] { results[1] = ++calls; },
+                         [&] { results[2] = ++calls; },
+                         [&] { results[3] = ++calls; });
+  EXPECT_EQ(calls.load(), 400);
+}
+
+TEST(ThreadPoolTest, NestedForkJoin) {
+  s21::thread_pool pool(4);
+  EXPECT_EQ(fib(pool, 25), 75025);
+}
+
+TEST(ThreadPoolTest, SharedFromSeveralThreads) {
+  std::vector<std::thread> callers;
+  std::vector<long long> results(3);
+  for (int i = 0; i < 3; ++i)
+    callers.emplace_back(
+        [&, i] { results[i] = fib(s21::thread_pool::shared(), 20 + i); });
+  for (auto &caller : callers) caller.join();
+  EXPECT_EQ(results[0], 6765);
+  EXPECT_EQ(results[1], 10946);
+  EXPECT_EQ(results[2], 17711);
+}
+
+TEST(ThreadPoolTest, PropagatesException) {
+  s21::thread_pool pool(2);
+  std::atomic<bool> other_done{false};
+  EXPECT_THROW(pool.parallel_invoke([] {}, [&] { other_done = true; },
+                                    [] { throw std::runtime_error("task"); }),
+               std::runtime_error);
+  EXPECT_TRUE(other_done.load());
+  EXPECT_NO_THROW(pool.parallel_invoke([] {}, [] {}));
+}
+
+TEST(ThreadPoolTest, ParallelForCoversEveryIndex) {
+  s21::thread_pool pool(3);
+  std::vector<std::atomic<int>> hits(1000);
+  pool.parallel_for(hits.size(), [&](std::size_t i) { ++hits[i]; });
+  for (const std::atomic<int> &hit : hits) EXPECT_EQ(hit.load(), 1);
+  pool.parallel_for(0, [](std::size_t) { FAIL(); });
+  EXPECT_THROW(pool.parallel_for(5,
+                                 [](std::size_t i) {
+                                   if (i == 3) throw std::runtime_error("3");
+                                 }),
+               std::runtime_error);
+}
@@ -0,0 +1,165 @@
+#include <gtest/gtest.h>
+
+#include <list>
+#include <random>
+#include <stdexcept>
+#include <string>
+
+#include "../s21_containersplus.h"
+
+template <class T, std::size_t N>
+void checkEqUnrolled(const S21::unrolled_list<T, N> &a,
+                     const std::list<T> &b) {
+  ASSERT_EQ(a.size(), b.size());
+  auto it1 = a.begin();
+  for (auto it2 = b.begin(); it2 != b.end(); ++it1, ++it2)
+    EXPECT_EQ(*it1, *it2);
+  EXPECT_EQ(it1, a.end());
+  // Обратный обход проверяет связи prev_
+  auto back = a.end();
+  for (auto it2 = b.rbegin(); it2 != b.rend(); ++it2) EXPECT_EQ(*--back, *it2);
+}
+
+TEST(UnrolledListTest, Constructors) {
+  S21::unrolled_list<int, 4> empty;
+  EXPECT_TRUE(empty.empty());
+  EXPECT_EQ(empty.begin(), empty.end());
+  S21::unrolled_list<int, 4> sized(10);
+  checkEqUnrolled(sized, std::list<int>(10));
+  S21::unrolled_list<int, 4> items{1, 2, 3, 4, 5, 6};
+  checkEqUnrolled(items, {1, 2, 3, 4, 5, 6});
+  S21::unrolled_list<int, 4> copy(items);
+  checkEqUnrolled(copy, {1, 2, 3, 4, 5, 6});
+  S21::unrolled_list<int, 4> moved(std::move(copy));
+  checkEqUnrolled(moved, {1, 2, 3, 4, 5, 6});
+  EXPECT_TRUE(copy.empty());
+  copy = moved;
+  checkEqUnrolled(copy, {1, 2, 3, 4, 5, 6});
+  empty = std::move(moved);
+  checkEqUnrolled(empty, {1, 2, 3, 4, 5, 6});
+}
+
+TEST(UnrolledListTest, NodesArePacked) {
+  S21::unrolled_list<int, 8> list;
+  for (int i = 0; i < 64; ++i) list.push_back(i);
+  EXPECT_EQ(list.node_count(), 8u);
+  S21::unrolled_list<int, 8> front;
+  for (int i = 0; i < 64; ++i) front.push_front(i);
+  EXPECT_EQ(front.node_count(), 8u);
+  EXPECT_EQ(front.front(), 63);
+  EXPECT_EQ(front.back(), 0);
+}
+
+TEST(UnrolledListTest, SplitOnOverflowMergeOnUnderflow) {
+  S21::unrolled_list<int, 4> list{1, 2, 3, 4};
+  EXPECT_EQ(list.node_count(), 1u);
+  auto it = list.insert(++list.begin(), 9);
+  EXPECT_EQ(*it, 9);
+  EXPECT_EQ(list.node_count(), 2u);
+  checkEqUnrolled(list, {1, 9, 2, 3, 4});
+  it = list.erase(list.begin());
+  EXPECT_EQ(*it, 9);
+  it = list.erase(it);
+  EXPECT_EQ(*it, 2);
+  EXPECT_EQ(list.node_count(), 1u);
+  checkEqUnrolled(list, {2, 3, 4});
+  list.erase(--list.end());
+  list.pop_back();
+  list.pop_front();
+  EXPECT_TRUE(list.empty());
+  EXPECT_EQ(list.node_count(), 0u);
+}
+
+TEST(UnrolledListTest, InsertElementMovedBySplit) {
+  S21::unrolled_list<std::string, 4> list{"a", "b", "c",
+                                          std::string(40, 'd')};
+  // back() лежит в верхней половине, которую split переносит
+  list.insert(++list.begin(), list.back());
+  checkEqUnrolled(list, {"a", std::string(40, 'd'), "b", "c",
+                         std::string(40, 'd')});
+  list.emplace(list.begin(), list.back());
+  EXPECT_EQ(list.front(), std::string(40, 'd'));
+  EXPECT_EQ(list.size(), 6u);
+}
+
+namespace {
+// Копирование бросает по счётчику, перенос не объявлен noexcept.
+struct Fragile {
+  static int copies_left;
+  explicit Fragile(int v) : value(v) {}
+  Fragile(const Fragile &other) : value(other.value) {
+    if (copies_left-- == 0) throw std::runtime_error("copy");
+  }
+  Fragile(Fragile &&other) : value(other.value) {}
+  Fragile &operator=(const Fragile &) = default;
+  Fragile &operator=(Fragile &&) = default;
+  int value;
+};
+int Fragile::copies_left = -1;
+}  // namespace
+
+TEST(UnrolledListTest, ThrowingRelocationKeepsList) {
+  S21::unrolled_list<Fragile, 4> list;
+  for (int i = 0; i < 4; ++i) list.emplace_back(i);
+  Fragile::copies_left = 1;
+  EXPECT_THROW(list.emplace(++list.begin(), 9), std::runtime_error);
+  Fragile::copies_left = -1;
+  EXPECT_EQ(list.size(), 4u);
+  EXPECT_EQ(list.node_count(), 1u);
+  int expected = 0;
+  for (const Fragile &item : list) EXPECT_EQ(item.value, expected++);
+  list.emplace(++list.begin(), 9);
+  EXPECT_EQ(list.node_count(), 2u);
+  EXPECT_EQ(list.size(), 5u);
+}
+
+TEST(UnrolledListTest, RandomOperationsMatchStdList) {
+  S21::unrolled_list<std::string, 5> list;
+  std::list<std::string> expected;
+  std::mt19937 gen(7);
+  for (int step = 0; step < 3000; ++step) {
+    std::size_t position = gen() % (expected.size() + 1);
+    auto it1 = list.begin();
+    auto it2 = expected.begin();
+    for (std::size_t i = 0; i < position; ++i) {
+      ++it1;
+      ++it2;
+    }
+    if (gen() % 3 != 0 || it2 == expected.end()) {
+      std::string value = std::to_string(step);
+      auto inserted = list.insert(it1, value);
+      expected.insert(it2, value);
+      EXPECT_EQ(*inserted, value);
+    } else {
+      auto next = list.erase(it1);
+      auto expected_next = expected.erase(it2);
+      if (expected_next != expected.end())
+        EXPECT_EQ(*next, *expected_next);
+      else
+        EXPECT_EQ(next, list.end());
+    }
+  }
+  checkEqUnrolled(list, expected);
+}
+
+TEST(UnrolledListTest, Splice) {
+  S21::unrolled_list<int, 4> list1{1, 2, 3, 4, 5, 6};
+  S21::unrolled_list<int, 4> list2{10, 20, 30};
+  list1.splice(++++list1.begin(), list2);
+  checkEqUnrolled(list1, {1, 2, 10, 20, 30, 3, 4, 5, 6});
+  EXPECT_TRUE(list2.empty());
+  S21::unrolled_list<int, 4> list3{7, 8};
+  list1.splice(list1.end(), list3);
+  list2.splice(list2.begin(), list1);
+  checkEqUnrolled(list2, {1, 2, 10, 20, 30, 3, 4, 5, 6, 7, 8});
+  EXPECT_TRUE(list1.empty());
+}
+
+TEST(UnrolledListTest, InsertMany) {
+  S21::unrolled_list<int, 4> list{1, 5};
+  auto it = list.insert_many(++list.begin(), 2, 3, 4);
+  EXPECT_EQ(*it, 5);
+  list.insert_many_back(6, 7);
+  list.insert_many_front(-1, 0);
+  checkEqUnrolled(list, {-1, 0, 1, 2, 3, 4, 5, 6, 7});
+}
@@ -1,5 +1,7 @@
 #include <gtest/gtest.h>
 
+#include <memory>
+#include <string>
 #include <vector>
 
 #include "../s21_vector.h"
@@ -437,6 +439,58 @@ TEST_F(VectorTest, InsertBack) {
   checkEqVector(s21_vector, std_vector);
 }
 
+TEST(VectorMoveTest, ClearKeepsBufferAndReleasesValues) {
+  auto shared = std::make_shared<int>(1);
+  s21::Vector<std::shared_ptr<int>> vector{shared, shared};
+  EXPECT_EQ(shared.use_count(), 3);
+  vector.clear();
+  EXPECT_EQ(shared.use_count(), 1);
+  EXPECT_EQ(vector.size(), 0u);
+  EXPECT_EQ(vector.capacity(), 2u);
+}
+
+TEST(VectorMoveTest, PushBackRvalueDoesNotCopy) {
+  struct Tracked {
+    Tracked() = default;
+    Tracked(const Tracked &) = default;
+    Tracked &operator=(const Tracked &) {
+      ++copies;
+      return *this;
+    }
+    Tracked &operator=(Tracked &&) noexcept { return *this; }
+    int copies = 0;
+  };
+  s21::Vector<Tracked> vector;
+  vector.reserve(2);
+  Tracked value;
+  vector.push_back(std::move(value));
+  vector.push_back(Tracked());
+  EXPECT_EQ(vector[0].copies, 0);
+  EXPECT_EQ(vector[1].copies, 0);
+  vector.push_back(value);
+  EXPECT_EQ(vector[2].copies, 1);
+}
+
+TEST(VectorMoveTest, MoveAssignReplacesBuffer) {
+  s21::Vector<std::string> target{"old", "values"};
+  s21::Vector<std::string> source{"new"};
+  target = std::move(source);
+  EXPECT_EQ(target.size(), 1u);
+  EXPECT_EQ(target[0], "new");
+  EXPECT_EQ(source.size(), 0u);
+  EXPECT_EQ(source.capacity(), 0u);
+}
+
+TEST(VectorMoveTest, PushBackAfterClear) {
+  s21::Vector<std::string> vector{"a", "b"};
+  vector.clear();
+  EXPECT_EQ(vector.capacity(), 2u);
+  std::string value(100, 'x');
+  vector.push_back(std::move(value));
+  EXPECT_EQ(vector.size(), 1u);
+  EXPECT_EQ(vector[0], std::string(100, 'x'));
+}
+
 // int main(int argc, char **argv) {
 //   testing::InitGoogleTest(&argc, argv);
 //   return RUN_ALL_TESTS();
@@ -0,0 +1,54 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "../s21_work_stealing_deque.h"
+
+TEST(WorkStealingDequeTest, OwnerIsLifoThiefIsFifo) {
+  s21::work_stealing_deque<int> deque(4);
+  int value = 0;
+  EXPECT_FALSE(deque.pop(value));
+  EXPECT_FALSE(deque.steal(value));
+  for (int i = 0; i < 100; ++i) deque.push(i);
+  EXPECT_GE(deque.capacity(), 100u);
+  EXPECT_EQ(deque.size(), 100u);
+  ASSERT_TRUE(deque.pop(value));
+  EXPECT_EQ(value, 99);
+  ASSERT_TRUE(deque.steal(value));
+  EXPECT_EQ(value, 0);
+  for (int i = 98; i > 0; --i) {
+    ASSERT_TRUE(deque.pop(value));
+    EXPECT_EQ(value, i);
+  }
+  EXPECT_FALSE(deque.pop(value));
+  EXPECT_TRUE(deque.empty());
+}
+
+TEST(WorkStealingDequeTest, ThievesTakeEachItemOnce) {
+  const int total = 100000, thieves = 3;
+  s21::work_stealing_deque<int> deque;
+  std::vector<std::atomic<int>> seen(total);
+  std::atomic<bool> done{false};
+  std::vector<std::thread> pool;
+  for (int t = 0; t < thieves; ++t)
+    pool.emplace_back([&] {
+      int value;
+      while (!done.load() || !deque.empty())
+        if (deque.steal(value))
+          seen[value].fetch_add(1);
+        else
+          std::this_thread::yield();
+    });
+  int value;
+  for (int i = 0; i < total; ++i) {
+    deque.push(i);
+    // Владелец тоже забирает часть, в том числе последний элемент
+    if (i % 3 == 0 && deque.pop(value)) seen[value].fetch_add(1);
+  }
+  while (deque.pop(value)) seen[value].fetch_add(1);
+  done = true;
+  for (auto &thread : pool) thread.join();
+  for (auto &count : seen) ASSERT_EQ(count.load(), 1);
+}